@@ -1607,14 +1607,15 @@ void LIR_Assembler::emit_alloc_array(LIR_OpAllocArray* op) {
 
 void LIR_Assembler::type_profile_helper(Register mdo,
                                         ciMethodData *md, ciProfileData *data,
-                                        Register recv, Label* update_done) {
+                                        Register recv, Label* update_done,
+                                        int increment) {
   for (uint i = 0; i < ReceiverTypeData::row_limit(); i++) {
     Label next_test;
     // See if the receiver is receiver[n].
     __ cmpptr(recv, Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_offset(i))));
     __ jccb(Assembler::notEqual, next_test);
     Address data_addr(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i)));
-    __ addptr(data_addr, DataLayout::counter_increment);
+    __ addptr(data_addr, increment);
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -1626,7 +1627,7 @@ void LIR_Assembler::type_profile_helper(Register mdo,
     __ cmpptr(recv_addr, (intptr_t)NULL_WORD);
     __ jccb(Assembler::notEqual, next_test);
     __ movptr(recv_addr, recv);
-    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), DataLayout::counter_increment);
+    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), increment);
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -3491,6 +3492,7 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
   ciMethod* method = op->profiled_method();
   int bci          = op->profiled_bci();
   ciMethod* callee = op->profiled_callee();
+  int increment    = compilation()->profile_counter_increment();
 
   // Update counter for all call types
   ciMethodData* md = method->method_data_or_null();
@@ -3522,7 +3524,7 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
         ciKlass* receiver = vc_data->receiver(i);
         if (known_klass->equals(receiver)) {
           Address data_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_count_offset(i)));
-          __ addptr(data_addr, DataLayout::counter_increment);
+          __ addptr(data_addr, increment);
           return;
         }
       }
@@ -3538,23 +3540,23 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
           Address recv_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_offset(i)));
           __ mov_metadata(recv_addr, known_klass->constant_encoding());
           Address data_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_count_offset(i)));
-          __ addptr(data_addr, DataLayout::counter_increment);
+          __ addptr(data_addr, increment);
           return;
         }
       }
     } else {
       __ load_klass(recv, recv);
       Label update_done;
-      type_profile_helper(mdo, md, data, recv, &update_done);
+      type_profile_helper(mdo, md, data, recv, &update_done, increment);
       // Receiver did not match any saved receiver and there is no empty row for it.
       // Increment total counter to indicate polymorphic case.
-      __ addptr(counter_addr, DataLayout::counter_increment);
+      __ addptr(counter_addr, increment);
 
       __ bind(update_done);
     }
   } else {
     // Static call
-    __ addptr(counter_addr, DataLayout::counter_increment);
+    __ addptr(counter_addr, increment);
   }
 }
 
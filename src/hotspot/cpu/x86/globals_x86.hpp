@@ -154,6 +154,12 @@ define_pd_global(bool, ThreadLocalHandshakes, false);
   product(bool, UseFastStosb, false,                                        \
           "Use fast-string operation for zeroing: rep stosb")               \
                                                                             \
+  product(uintx, NonTemporalStoreThreshold, 0,                             \
+          "Arraycopy, fill and large array clearing of at least this many " \
+          "bytes use non-temporal stores that bypass the caches. "          \
+          "0 disables. By default set to half of the last level cache")     \
+          range(0, max_jint)                                                \
+                                                                            \
   /* Use Restricted Transactional Memory for lock eliding */                \
   product(bool, UseRTMLocking, false,                                       \
           "Enable RTM lock eliding for inflated locks in compiled code")    \
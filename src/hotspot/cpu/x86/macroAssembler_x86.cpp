@@ -5530,15 +5530,57 @@ void MacroAssembler::xmm_clear_mem(Register base, Register cnt, XMMRegister xtmp
   // cnt - number of qwords (8-byte words).
   // base - start address, qword aligned.
   Label L_zero_64_bytes, L_loop, L_sloop, L_tail, L_end;
-  if (UseAVX >= 2) {
+  if (UseAVX > 2) {
+    vpxor(xtmp, xtmp, xtmp, AVX_512bit);
+  } else if (UseAVX == 2) {
     vpxor(xtmp, xtmp, xtmp, AVX_256bit);
   } else {
     pxor(xtmp, xtmp);
   }
+
+  if (NonTemporalStoreThreshold > 0) {
+    // Clearing at least NonTemporalStoreThreshold bytes: align base to
+    // 64 bytes with qword stores, then stream 64-byte blocks past the caches.
+    Label L_temporal, L_align, L_nt, L_nt_loop;
+    cmpptr(cnt, (int32_t)(NonTemporalStoreThreshold / BytesPerLong));
+    jcc(Assembler::below, L_temporal);
+
+    BIND(L_align);
+    testptr(base, 63);
+    jccb(Assembler::zero, L_nt);
+    movq(Address(base, 0), xtmp);
+    addptr(base, 8);
+    decrement(cnt);
+    jmpb(L_align);
+
+    BIND(L_nt);
+    subptr(cnt, 8);
+    align(16);
+    BIND(L_nt_loop);
+    if (UseAVX > 2) {
+      vmovntdq(Address(base,  0), xtmp, AVX_512bit);
+    } else if (UseAVX == 2) {
+      vmovntdq(Address(base,  0), xtmp, AVX_256bit);
+      vmovntdq(Address(base, 32), xtmp, AVX_256bit);
+    } else {
+      movntdq(Address(base,  0), xtmp);
+      movntdq(Address(base, 16), xtmp);
+      movntdq(Address(base, 32), xtmp);
+      movntdq(Address(base, 48), xtmp);
+    }
+    addptr(base, 64);
+    subptr(cnt, 8);
+    jcc(Assembler::greaterEqual, L_nt_loop);
+    addptr(cnt, 8);
+    sfence();
+    BIND(L_temporal);
+  }
   jmp(L_zero_64_bytes);
 
   BIND(L_loop);
-  if (UseAVX >= 2) {
+  if (UseAVX > 2) {
+    evmovdqul(Address(base, 0), xtmp, AVX_512bit);
+  } else if (UseAVX == 2) {
     vmovdqu(Address(base,  0), xtmp);
     vmovdqu(Address(base, 32), xtmp);
   } else {
@@ -7165,6 +7207,10 @@ void MacroAssembler::generate_fill(BasicType t, bool aligned,
         Label L_fill_64_bytes_loop, L_check_fill_32_bytes;
         vpbroadcastd(xtmp, xtmp, Assembler::AVX_512bit);
 
+        if (NonTemporalStoreThreshold > 0) {
+          fill64_nontemporal(to, count, rtmp, xtmp, shift);
+        }
+
         subl(count, 16 << shift);
         jcc(Assembler::less, L_check_fill_32_bytes);
         align(16);
@@ -7188,6 +7234,10 @@ void MacroAssembler::generate_fill(BasicType t, bool aligned,
         Label L_fill_64_bytes_loop, L_check_fill_32_bytes;
         vpbroadcastd(xtmp, xtmp, Assembler::AVX_256bit);
 
+        if (NonTemporalStoreThreshold > 0) {
+          fill64_nontemporal(to, count, rtmp, xtmp, shift);
+        }
+
         subl(count, 16 << shift);
         jcc(Assembler::less, L_check_fill_32_bytes);
         align(16);
@@ -7280,6 +7330,55 @@ void MacroAssembler::generate_fill(BasicType t, bool aligned,
   BIND(L_exit);
 }
 
+// Fill 'count' elements of (4 >> shift) bytes at 'to' with non-temporal
+// stores when the fill is at least NonTemporalStoreThreshold bytes long.
+// 'xtmp' holds the value broadcast to the full vector width. On exit
+// fewer than 64 bytes are left for the regular fill loops.
+void MacroAssembler::fill64_nontemporal(Register to, Register count, Register rtmp,
+                                        XMMRegister xtmp, int shift) {
+  assert(UseAVX >= 2 && UseUnalignedLoadStores, "sanity");
+  uintx threshold = (NonTemporalStoreThreshold >> 2) << shift; // in elements
+  if (threshold == 0 || threshold > (uintx)max_jint) {
+    return;
+  }
+  Label L_temporal, L_nt_loop;
+  cmpl(count, (int32_t)threshold);
+  jcc(Assembler::below, L_temporal);
+
+  // One unaligned 64-byte store covers the head up to the next 64-byte boundary
+  if (UseAVX > 2) {
+    evmovdqul(Address(to, 0), xtmp, Assembler::AVX_512bit);
+  } else {
+    vmovdqu(Address(to, 0), xtmp);
+    vmovdqu(Address(to, 32), xtmp);
+  }
+  movptr(rtmp, to);
+  andptr(rtmp, 63);
+  negptr(rtmp);
+  addptr(rtmp, 64);   // bytes up to the boundary, 1..64
+  addptr(to, rtmp);
+  if (shift < 2) {
+    shrptr(rtmp, 2 - shift); // bytes to elements
+  }
+  subl(count, rtmp);
+
+  subl(count, 16 << shift);
+  align(16);
+  BIND(L_nt_loop);
+  if (UseAVX > 2) {
+    vmovntdq(Address(to, 0), xtmp, Assembler::AVX_512bit);
+  } else {
+    vmovntdq(Address(to, 0), xtmp, Assembler::AVX_256bit);
+    vmovntdq(Address(to, 32), xtmp, Assembler::AVX_256bit);
+  }
+  addptr(to, 64);
+  subl(count, 16 << shift);
+  jcc(Assembler::greaterEqual, L_nt_loop);
+  addl(count, 16 << shift);
+  sfence();
+  BIND(L_temporal);
+}
+
 // encode char[] to byte[] in ISO_8859_1
    //@HotSpotIntrinsicCandidate
    //private static int implEncodeISOArray(byte[] sa, int sp,
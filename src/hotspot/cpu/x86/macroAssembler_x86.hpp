@@ -1659,6 +1659,10 @@ public:
                      Register to, Register value, Register count,
                      Register rtmp, XMMRegister xtmp);
 
+  // Fill part of a large array with non-temporal stores (helper for generate_fill)
+  void fill64_nontemporal(Register to, Register count, Register rtmp,
+                          XMMRegister xtmp, int shift);
+
   void encode_iso_array(Register src, Register dst, Register len,
                         XMMRegister tmp1, XMMRegister tmp2, XMMRegister tmp3,
                         XMMRegister tmp4, Register tmp5, Register result);
@@ -1907,6 +1907,14 @@ static void gen_special_dispatch(MacroAssembler* masm,
 //    transition back to thread_in_Java
 //    return to caller
 //
+// Trivial native functions (-XX:+TrivialJNINatives) use the critical
+// native calling convention but promise to neither block nor call back
+// into the VM.  They are called without any thread state transition: the
+// thread stays _thread_in_Java, so no safepoint can begin while the native
+// runs and array arguments cannot move unless the heap relocates objects
+// concurrently, in which case they are pinned.  The GCLocker check, the
+// safepoint poll and the suspend check after the call are all skipped.
+//
 nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
                                                 const methodHandle& method,
                                                 int compile_id,
@@ -1935,7 +1943,12 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
                                        (OopMapSet*)NULL);
   }
   bool is_critical_native = true;
-  address native_func = method->critical_native_function();
+  bool is_trivial_native = true;
+  address native_func = method->trivial_native_function();
+  if (native_func == NULL) {
+    native_func = method->critical_native_function();
+    is_trivial_native = false;
+  }
   if (native_func == NULL) {
     native_func = method->native_function();
     is_critical_native = false;
@@ -2208,7 +2221,7 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
 
   const Register oop_handle_reg = r14;
 
-  if (is_critical_native && !Universe::heap()->supports_object_pinning()) {
+  if (is_critical_native && !is_trivial_native && !Universe::heap()->supports_object_pinning()) {
     check_needs_gc_for_critical_native(masm, stack_slots, total_c_args, total_in_args,
                                        oop_handle_offset, oop_maps, in_regs, in_sig_bt);
   }
@@ -2414,7 +2427,9 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
   intptr_t the_pc = (intptr_t) __ pc();
   oop_maps->add_gc_map(the_pc - start, map);
 
-  __ set_last_Java_frame(rsp, noreg, (address)the_pc);
+  if (!is_trivial_native) {
+    __ set_last_Java_frame(rsp, noreg, (address)the_pc);
+  }
 
 
   // We have all of the arguments setup at this point. We must not touch any register
@@ -2522,7 +2537,9 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
   }
 
   // Now set thread in native
-  __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_native);
+  if (!is_trivial_native) {
+    __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_native);
+  }
 
   __ call(RuntimeAddress(native_func));
 
@@ -2566,6 +2583,13 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
     restore_native_result(masm, ret_type, stack_slots);
   }
 
+  Label after_transition;
+
+  if (is_trivial_native) {
+    // The thread never left _thread_in_Java.
+    __ jmp(after_transition);
+  }
+
   // Switch thread to "native transition" state before reading the synchronization state.
   // This additional state is necessary because reading and testing the synchronization
   // state is not atomic w.r.t. GC, as this scenario demonstrates:
@@ -2580,8 +2604,6 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
               Assembler::LoadLoad | Assembler::LoadStore |
               Assembler::StoreLoad | Assembler::StoreStore));
 
-  Label after_transition;
-
   // check for safepoint operation in progress and/or pending suspend requests
   {
     Label Continue;
@@ -2691,7 +2713,9 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
     restore_native_result(masm, ret_type, stack_slots);
   }
 
-  __ reset_last_Java_frame(false);
+  if (!is_trivial_native) {
+    __ reset_last_Java_frame(false);
+  }
 
   // Unbox oop result, e.g. JNIHandles::resolve value.
   if (ret_type == T_OBJECT || ret_type == T_ARRAY) {
@@ -2844,7 +2868,7 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
                                             in_ByteSize(lock_slot_offset*VMRegImpl::stack_slot_size),
                                             oop_maps);
 
-  if (is_critical_native) {
+  if (is_critical_native && !is_trivial_native) {
     nm->set_lazy_critical_native(true);
   }
 
@@ -1251,7 +1251,57 @@ class StubGenerator: public StubCodeGenerator {
                              Register qword_count, Register to,
                              Label& L_copy_bytes, Label& L_copy_8_bytes) {
     DEBUG_ONLY(__ stop("enter at entry label, not here"));
-    Label L_loop;
+    Label L_loop, L_loop_check;
+    bool use_nt = UseUnalignedLoadStores && NonTemporalStoreThreshold > 0;
+    if (use_nt) {
+      // Copies of at least NonTemporalStoreThreshold bytes bypass the caches:
+      // copy qwords until the destination is 64-byte aligned, then stream
+      // 64-byte blocks with non-temporal stores.
+      Label L_temporal, L_align_loop, L_nt_loop, L_nt_check;
+      __ BIND(L_copy_bytes);
+      __ cmpptr(qword_count, -(int)(NonTemporalStoreThreshold / BytesPerLong));
+      __ jcc(Assembler::greater, L_temporal);
+      __ lea(to, Address(end_to, qword_count, Address::times_8, 8));
+      __ testptr(to, 7);
+      __ jcc(Assembler::notZero, L_temporal);
+
+      __ BIND(L_align_loop);
+      __ testptr(to, 63);
+      __ jccb(Assembler::zero, L_nt_check);
+      __ movq(xmm0, Address(end_from, qword_count, Address::times_8, 8));
+      __ movq(Address(end_to, qword_count, Address::times_8, 8), xmm0);
+      __ addptr(to, 8);
+      __ addptr(qword_count, 1);
+      __ jmpb(L_align_loop);
+
+      __ align(OptoLoopAlignment);
+      __ BIND(L_nt_loop);
+      if (UseAVX > 2) {
+        __ evmovdqul(xmm0, Address(end_from, qword_count, Address::times_8, -56), Assembler::AVX_512bit);
+        __ vmovntdq(Address(end_to, qword_count, Address::times_8, -56), xmm0, Assembler::AVX_512bit);
+      } else if (UseAVX == 2) {
+        __ vmovdqu(xmm0, Address(end_from, qword_count, Address::times_8, -56));
+        __ vmovntdq(Address(end_to, qword_count, Address::times_8, -56), xmm0, Assembler::AVX_256bit);
+        __ vmovdqu(xmm1, Address(end_from, qword_count, Address::times_8, -24));
+        __ vmovntdq(Address(end_to, qword_count, Address::times_8, -24), xmm1, Assembler::AVX_256bit);
+      } else {
+        __ movdqu(xmm0, Address(end_from, qword_count, Address::times_8, -56));
+        __ movntdq(Address(end_to, qword_count, Address::times_8, -56), xmm0);
+        __ movdqu(xmm1, Address(end_from, qword_count, Address::times_8, -40));
+        __ movntdq(Address(end_to, qword_count, Address::times_8, -40), xmm1);
+        __ movdqu(xmm2, Address(end_from, qword_count, Address::times_8, -24));
+        __ movntdq(Address(end_to, qword_count, Address::times_8, -24), xmm2);
+        __ movdqu(xmm3, Address(end_from, qword_count, Address::times_8, - 8));
+        __ movntdq(Address(end_to, qword_count, Address::times_8, - 8), xmm3);
+      }
+      __ BIND(L_nt_check);
+      __ addptr(qword_count, 8);
+      __ jcc(Assembler::lessEqual, L_nt_loop);
+      __ subptr(qword_count, 8);
+      __ sfence(); // order the streaming stores before the caller's stores
+      __ BIND(L_temporal);
+      __ jmp(L_loop_check);
+    }
     __ align(OptoLoopAlignment);
     if (UseUnalignedLoadStores) {
       Label L_end;
@@ -1275,7 +1325,11 @@ class StubGenerator: public StubCodeGenerator {
         __ movdqu(xmm3, Address(end_from, qword_count, Address::times_8, - 8));
         __ movdqu(Address(end_to, qword_count, Address::times_8, - 8), xmm3);
       }
-      __ BIND(L_copy_bytes);
+      if (use_nt) {
+        __ BIND(L_loop_check);
+      } else {
+        __ BIND(L_copy_bytes);
+      }
       __ addptr(qword_count, 8);
       __ jcc(Assembler::lessEqual, L_loop);
       __ subptr(qword_count, 4);  // sub(8) and add(4)
@@ -4972,6 +5026,299 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  // Emits 32 copies of the byte b, a ymm operand of vector Base64 decoding.
+  void base64_emit_broadcast(uint8_t b) {
+    jlong v = (jlong)((julong)b * CONST64(0x0101010101010101));
+    for (int i = 0; i < 4; i++) {
+      __ emit_data64(v, relocInfo::none);
+    }
+  }
+
+  // Base64 decoding constants for one alphabet. Rows 0-7 (32 bytes each) are
+  // the bounds of the ranges 'A'-'Z', 'a'-'z', '0'-'9' and the two extra
+  // characters, rows 8-12 the offsets that translate each range to its 6-bit
+  // values. A 256 entry table of the 6-bit value of each byte, or -1 if the
+  // byte is not part of the alphabet, follows at base64_decoding_lookup.
+  static const int base64_decoding_lookup = 13 * 32;
+
+  address base64_decoding_table_addr(bool isURL) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", isURL ? "base64url_decoding_table" : "base64_decoding_table");
+    address start = __ pc();
+    const uint8_t c62 = isURL ? '-' : '+';
+    const uint8_t c63 = isURL ? '_' : '/';
+    const uint8_t rows[] = {
+      'A' - 1, 'Z' + 1, 'a' - 1, 'z' + 1, '0' - 1, '9' + 1, c62, c63,
+      (uint8_t)(0 - 'A'), (uint8_t)(26 - 'a'), (uint8_t)(52 - '0'), (uint8_t)(62 - c62), (uint8_t)(63 - c63)
+    };
+    assert(sizeof(rows) * 32 == base64_decoding_lookup, "sanity");
+    for (size_t i = 0; i < sizeof(rows); i++) {
+      base64_emit_broadcast(rows[i]);
+    }
+    for (int i = 0; i < 256; i += 8) {
+      julong v = 0;
+      for (int j = 7; j >= 0; j--) {
+        int c = i + j;
+        int value = (c >= 'A' && c <= 'Z') ? c - 'A' :
+                    (c >= 'a' && c <= 'z') ? c - 'a' + 26 :
+                    (c >= '0' && c <= '9') ? c - '0' + 52 :
+                    (c == c62) ? 62 :
+                    (c == c63) ? 63 : -1;
+        v = (v << 8) | (uint8_t)value;
+      }
+      __ emit_data64((jlong)v, relocInfo::none);
+    }
+    return start;
+  }
+
+  // Masks that pack 32 6-bit values into 24 bytes: vpmaddubsw and vpmaddwd
+  // multipliers, the vpshufb mask gathering the 12 bytes of each lane and the
+  // vpermd indices moving them next to each other.
+  address base64_decoding_pack_addr() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "base64_decoding_pack");
+    address start = __ pc();
+    for (int i = 0; i < 4; i++) {
+      __ emit_data64(0x0140014001400140, relocInfo::none);
+    }
+    for (int i = 0; i < 4; i++) {
+      __ emit_data64(0x0001100000011000, relocInfo::none);
+    }
+    for (int i = 0; i < 2; i++) {
+      __ emit_data64(0x090a040506000102, relocInfo::none);
+      __ emit_data64(0xffffffff0c0d0e08, relocInfo::none);
+    }
+    __ emit_data64(0x0000000100000000, relocInfo::none);
+    __ emit_data64(0x0000000400000002, relocInfo::none);
+    __ emit_data64(0x0000000600000005, relocInfo::none);
+    __ emit_data64(0x0000000700000007, relocInfo::none);
+    return start;
+  }
+
+// Code for generating Base64 decoding.
+// Intrinsic function prototype in Base64.java:
+// private int decodeBlock(byte[] src, int sp, int sl, byte[] dst, int dp, boolean isURL, boolean isMIME) {
+//
+// Decodes complete 4-byte atoms until one holds a byte that is not part of
+// the alphabet, and returns the number of bytes written. The Java code deals
+// with what is left, padding and errors alike.
+//
+// isMIME is deliberately not read. MIME input only differs in that it may
+// contain line separators, which are not part of the alphabet: the stub
+// stops in front of them like in front of any other illegal byte, exactly
+// as the Java implementation of decodeBlock does, and decode0 skips them.
+  address generate_base64_decodeBlock() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "implDecode");
+    address start = __ pc();
+    __ enter();
+
+    // Save callee-saved registers before using them
+    __ push(r12);
+    __ push(r13);
+    __ push(r14);
+
+#ifdef _WIN64
+    // xmm6-xmm15 are callee-saved on Win64, the vector loop uses all of them
+    const int xmm_save_count = 10;
+    const int xmm_save_size = 2 * wordSize;
+    if (UseAVX >= 2) {
+      __ subptr(rsp, xmm_save_count * xmm_save_size);
+      for (int i = 0; i < xmm_save_count; i++) {
+        __ movdqu(Address(rsp, i * xmm_save_size), as_XMMRegister(6 + i));
+      }
+    }
+#endif
+
+    // arguments
+    const Register source = c_rarg0; // Source Array
+    const Register start_offset = c_rarg1; // start offset
+    const Register end_offset = c_rarg2; // end offset
+    const Register dest = c_rarg3; // destination array
+
+#ifndef _WIN64
+    const Register dp = c_rarg4;  // Position for writing to dest array
+    const Register isURL = c_rarg5;// Base64 or URL character set
+#else
+    const Address  dp_mem(rbp, 6 * wordSize);  // dp and isURL are on stack on Win64
+    const Address isURL_mem(rbp, 7 * wordSize);
+#endif
+
+    const Register table = r11;
+    const Register pack = r12;
+    const Register dest_start = r13;
+    const Register length = r14;
+    const Register tmp = r10;
+#ifndef _WIN64
+    assert_different_registers(source, start_offset, end_offset, dest, dp, isURL,
+                               table, pack, dest_start, length, tmp, rax);
+#else
+    assert_different_registers(source, start_offset, end_offset, dest,
+                               table, pack, dest_start, length, tmp, rax);
+#endif
+    Label L_process32, L_process4, L_exit, L_processdata;
+
+    // calculate length from offsets, and start at src[sp] and dst[dp]
+    __ movl(length, end_offset);
+    __ subl(length, start_offset);
+    __ movl(start_offset, start_offset);
+    __ addptr(source, start_offset);
+#ifndef _WIN64
+    __ movl(dp, dp);
+    __ addptr(dest, dp);
+#else
+    __ movl(tmp, dp_mem);  // zero extends
+    __ addptr(dest, tmp);
+#endif
+    __ movptr(dest_start, dest);
+    __ cmpl(length, 4);
+    __ jcc(Assembler::less, L_exit);
+
+    __ lea(table, ExternalAddress(StubRoutines::x86::base64_decoding_table_addr()));
+    // check if base64 charset(isURL=0) or base64 url charset(isURL=1) needs to be loaded
+#ifndef _WIN64
+    __ cmpl(isURL, 0);
+#else
+    __ cmpl(isURL_mem, 0);
+#endif
+    __ jcc(Assembler::equal, L_processdata);
+    __ lea(table, ExternalAddress(StubRoutines::x86::base64url_decoding_table_addr()));
+
+    __ BIND(L_processdata);
+    if (UseAVX >= 2) {
+      __ cmpl(length, 32);
+      __ jcc(Assembler::less, L_process4);
+
+      // load range bounds and packing masks
+      __ vmovdqu(xmm8, Address(table, 0 * 32));
+      __ vmovdqu(xmm9, Address(table, 1 * 32));
+      __ vmovdqu(xmm10, Address(table, 2 * 32));
+      __ vmovdqu(xmm11, Address(table, 3 * 32));
+      __ vmovdqu(xmm12, Address(table, 4 * 32));
+      __ vmovdqu(xmm13, Address(table, 5 * 32));
+      __ vmovdqu(xmm14, Address(table, 6 * 32));
+      __ vmovdqu(xmm15, Address(table, 7 * 32));
+      __ lea(pack, ExternalAddress(StubRoutines::x86::base64_decoding_pack_addr()));
+      __ vmovdqu(xmm5, Address(pack, 0));
+      __ vmovdqu(xmm6, Address(pack, 32));
+      __ vmovdqu(xmm7, Address(pack, 64));
+
+      // Vector Base64 implementation, decoding 32 bytes into 24 bytes.
+      // xmm1 collects the bytes that are part of the alphabet, xmm4 the
+      // offsets that translate them to their 6-bit values.
+      __ BIND(L_process32);
+      __ vmovdqu(xmm0, Address(source, 0));
+      // 'A'-'Z'
+      __ vpcmpgtb(xmm1, xmm0, xmm8, Assembler::AVX_256bit);
+      __ vpcmpgtb(xmm2, xmm9, xmm0, Assembler::AVX_256bit);
+      __ vpand(xmm1, xmm1, xmm2, Assembler::AVX_256bit);
+      __ vpand(xmm4, xmm1, Address(table, 8 * 32), Assembler::AVX_256bit);
+      // 'a'-'z'
+      __ vpcmpgtb(xmm2, xmm0, xmm10, Assembler::AVX_256bit);
+      __ vpcmpgtb(xmm3, xmm11, xmm0, Assembler::AVX_256bit);
+      __ vpand(xmm2, xmm2, xmm3, Assembler::AVX_256bit);
+      __ vpor(xmm1, xmm1, xmm2, Assembler::AVX_256bit);
+      __ vpand(xmm2, xmm2, Address(table, 9 * 32), Assembler::AVX_256bit);
+      __ vpor(xmm4, xmm4, xmm2, Assembler::AVX_256bit);
+      // '0'-'9'
+      __ vpcmpgtb(xmm2, xmm0, xmm12, Assembler::AVX_256bit);
+      __ vpcmpgtb(xmm3, xmm13, xmm0, Assembler::AVX_256bit);
+      __ vpand(xmm2, xmm2, xmm3, Assembler::AVX_256bit);
+      __ vpor(xmm1, xmm1, xmm2, Assembler::AVX_256bit);
+      __ vpand(xmm2, xmm2, Address(table, 10 * 32), Assembler::AVX_256bit);
+      __ vpor(xmm4, xmm4, xmm2, Assembler::AVX_256bit);
+      // '+' or '-', '/' or '_'
+      __ vpcmpeqb(xmm2, xmm0, xmm14, Assembler::AVX_256bit);
+      __ vpor(xmm1, xmm1, xmm2, Assembler::AVX_256bit);
+      __ vpand(xmm2, xmm2, Address(table, 11 * 32), Assembler::AVX_256bit);
+      __ vpor(xmm4, xmm4, xmm2, Assembler::AVX_256bit);
+      __ vpcmpeqb(xmm2, xmm0, xmm15, Assembler::AVX_256bit);
+      __ vpor(xmm1, xmm1, xmm2, Assembler::AVX_256bit);
+      __ vpand(xmm2, xmm2, Address(table, 12 * 32), Assembler::AVX_256bit);
+      __ vpor(xmm4, xmm4, xmm2, Assembler::AVX_256bit);
+
+      // leave the atom with the illegal byte to the scalar loop below,
+      // which stops in front of it
+      __ vpmovmskb(tmp, xmm1);
+      __ cmpl(tmp, -1);
+      __ jcc(Assembler::notEqual, L_process4);
+
+      // translate, then merge 4 6-bit values into 3 bytes:
+      // (v0 << 6 | v1) and (v2 << 6 | v3) as words, then 24 bits per dword
+      __ vpaddb(xmm0, xmm0, xmm4, Assembler::AVX_256bit);
+      __ vpmaddubsw(xmm0, xmm0, xmm5, Assembler::AVX_256bit);
+      __ vpmaddwd(xmm0, xmm0, xmm6, Assembler::AVX_256bit);
+      // big endian bytes, 12 per lane, then 24 consecutive ones
+      __ vpshufb(xmm0, xmm0, xmm7, Assembler::AVX_256bit);
+      __ vmovdqu(xmm2, Address(pack, 96));
+      __ vpermd(xmm0, xmm2, xmm0, Assembler::AVX_256bit);
+      __ movdqu(Address(dest, 0), xmm0);
+      __ vextracti128_high(xmm1, xmm0);
+      __ movq(Address(dest, 16), xmm1);
+
+      __ addptr(source, 32);
+      __ addptr(dest, 24);
+      __ subl(length, 32);
+      __ cmpl(length, 32);
+      __ jcc(Assembler::greaterEqual, L_process32);
+    }
+
+    // Scalar data processing takes 4 bytes at a time and produces 3 bytes of decoded data
+    /* This code corresponds to the scalar version of the following snippet in Base64.java
+    ** int b1 = base64[src[sp++] & 0xff];
+    ** int b2 = base64[src[sp++] & 0xff];
+    ** int b3 = base64[src[sp++] & 0xff];
+    ** int b4 = base64[src[sp++] & 0xff];
+    ** if ((b1 | b2 | b3 | b4) < 0) break;
+    ** int bits0 = b1 << 18 | b2 << 12 | b3 << 6 | b4;
+    ** dst[dp0++] = (byte)(bits0 >> 16);
+    ** dst[dp0++] = (byte)(bits0 >>  8);
+    ** dst[dp0++] = (byte)(bits0); */
+    __ BIND(L_process4);
+    __ cmpl(length, 4);
+    __ jcc(Assembler::less, L_exit);
+    // Illegal bytes map to -1, which keeps the accumulated bits negative
+    __ movzbl(rax, Address(source, 0));
+    __ movsbl(tmp, Address(table, rax, Address::times_1, base64_decoding_lookup));
+    for (int i = 1; i < 4; i++) {
+      __ movzbl(rax, Address(source, i));
+      __ movsbl(rax, Address(table, rax, Address::times_1, base64_decoding_lookup));
+      __ shll(tmp, 6);
+      __ orl(tmp, rax);
+    }
+    __ testl(tmp, tmp);
+    __ jcc(Assembler::negative, L_exit);
+    __ movb(Address(dest, 2), tmp);
+    __ shrl(tmp, 8);
+    __ movb(Address(dest, 1), tmp);
+    __ shrl(tmp, 8);
+    __ movb(Address(dest, 0), tmp);
+    __ addptr(source, 4);
+    __ addptr(dest, 3);
+    __ subl(length, 4);
+    __ jmp(L_process4);
+
+    __ BIND(L_exit);
+    // return the number of bytes written
+    __ movptr(rax, dest);
+    __ subptr(rax, dest_start);
+    if (UseAVX >= 2) {
+      __ vzeroupper();
+#ifdef _WIN64
+      for (int i = 0; i < xmm_save_count; i++) {
+        __ movdqu(as_XMMRegister(6 + i), Address(rsp, i * xmm_save_size));
+      }
+      __ addptr(rsp, xmm_save_count * xmm_save_size);
+#endif
+    }
+    __ pop(r14);
+    __ pop(r13);
+    __ pop(r12);
+    __ leave();
+    __ ret(0);
+    return start;
+  }
+
   /**
    *  Arguments:
    *
@@ -5937,14 +6284,22 @@ address generate_avx_ghash_processBlocks() {
     }
 
     if (UseBASE64Intrinsics) {
-      StubRoutines::x86::_and_mask = base64_and_mask_addr();
-      StubRoutines::x86::_bswap_mask = base64_bswap_mask_addr();
-      StubRoutines::x86::_base64_charset = base64_charset_addr();
-      StubRoutines::x86::_url_charset = base64url_charset_addr();
-      StubRoutines::x86::_gather_mask = base64_gather_mask_addr();
-      StubRoutines::x86::_left_shift_mask = base64_left_shift_mask_addr();
-      StubRoutines::x86::_right_shift_mask = base64_right_shift_mask_addr();
-      StubRoutines::_base64_encodeBlock = generate_base64_encodeBlock();
+      // The encoder needs EVEX, the decoder makes do with AVX2 (or even
+      // no vectors at all).
+      if (UseAVX > 2 && VM_Version::supports_avx512vl() && VM_Version::supports_avx512bw()) {
+        StubRoutines::x86::_and_mask = base64_and_mask_addr();
+        StubRoutines::x86::_bswap_mask = base64_bswap_mask_addr();
+        StubRoutines::x86::_base64_charset = base64_charset_addr();
+        StubRoutines::x86::_url_charset = base64url_charset_addr();
+        StubRoutines::x86::_gather_mask = base64_gather_mask_addr();
+        StubRoutines::x86::_left_shift_mask = base64_left_shift_mask_addr();
+        StubRoutines::x86::_right_shift_mask = base64_right_shift_mask_addr();
+        StubRoutines::_base64_encodeBlock = generate_base64_encodeBlock();
+      }
+      StubRoutines::x86::_base64_decoding_table = base64_decoding_table_addr(false);
+      StubRoutines::x86::_base64url_decoding_table = base64_decoding_table_addr(true);
+      StubRoutines::x86::_base64_decoding_pack = base64_decoding_pack_addr();
+      StubRoutines::_base64_decodeBlock = generate_base64_decodeBlock();
     }
 
     // Safefetch stubs.
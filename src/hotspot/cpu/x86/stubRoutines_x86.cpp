@@ -55,6 +55,9 @@ address StubRoutines::x86::_right_shift_mask = NULL;
 address StubRoutines::x86::_left_shift_mask = NULL;
 address StubRoutines::x86::_and_mask = NULL;
 address StubRoutines::x86::_url_charset = NULL;
+address StubRoutines::x86::_base64_decoding_table = NULL;
+address StubRoutines::x86::_base64url_decoding_table = NULL;
+address StubRoutines::x86::_base64_decoding_pack = NULL;
 
 #endif
 address StubRoutines::x86::_pshuffle_byte_flip_mask_addr = NULL;
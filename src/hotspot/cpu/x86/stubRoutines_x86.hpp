@@ -154,6 +154,9 @@ class x86 {
   static address _left_shift_mask;
   static address _and_mask;
   static address _url_charset;
+  static address _base64_decoding_table;
+  static address _base64url_decoding_table;
+  static address _base64_decoding_pack;
 #endif
   // byte flip mask for sha256
   static address _pshuffle_byte_flip_mask_addr;
@@ -223,6 +226,9 @@ class x86 {
   static address base64_right_shift_mask_addr() { return _right_shift_mask; }
   static address base64_left_shift_mask_addr() { return _left_shift_mask; }
   static address base64_and_mask_addr() { return _and_mask; }
+  static address base64_decoding_table_addr() { return _base64_decoding_table; }
+  static address base64url_decoding_table_addr() { return _base64url_decoding_table; }
+  static address base64_decoding_pack_addr() { return _base64_decoding_pack; }
 #endif
   static address pshuffle_byte_flip_mask_addr() { return _pshuffle_byte_flip_mask_addr; }
   static void generate_CRC32C_table(bool is_pclmulqdq_supported);
@@ -46,7 +46,7 @@ address VM_Version::_cpuinfo_segv_addr = 0;
 address VM_Version::_cpuinfo_cont_addr = 0;
 
 static BufferBlob* stub_blob;
-static const int stub_size = 1100;
+static const int stub_size = 1300;
 
 extern "C" {
   typedef void (*get_cpu_info_stub_t)(void*);
@@ -215,6 +215,24 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ movl(Address(rsi, 8), rcx);
     __ movl(Address(rsi,12), rdx);
 
+    // Walk the next cache levels, the last valid one is the last level cache
+    for (int level = 1; level <= 3; level++) {
+      __ movl(rax, 4);
+      __ movl(rcx, level);
+      __ cpuid();
+      __ push(rax);
+      __ andl(rax, 0x1f);  // Determine if valid cache parameters used
+      __ orl(rax, rax);    // eax[4:0] == 0 indicates no more caches
+      __ pop(rax);
+      __ jcc(Assembler::equal, std_cpuid1);
+
+      __ lea(rsi, Address(rbp, in_bytes(VM_Version::llc_cpuid4_offset())));
+      __ movl(Address(rsi, 0), rax);
+      __ movl(Address(rsi, 4), rbx);
+      __ movl(Address(rsi, 8), rcx);
+      __ movl(Address(rsi,12), rdx);
+    }
+
     //
     // Standard cpuid(0x1)
     //
@@ -855,13 +873,14 @@ void VM_Version::get_processor_features() {
   }
 
   // Base64 Intrinsics (Check the condition for which the intrinsic will be active)
-  if ((UseAVX > 2) && supports_avx512vl() && supports_avx512bw()) {
+  // Decoding needs AVX2, encoding additionally EVEX; see StubGenerator.
+  if (UseAVX >= 2) {
     if (FLAG_IS_DEFAULT(UseBASE64Intrinsics)) {
       UseBASE64Intrinsics = true;
     }
   } else if (UseBASE64Intrinsics) {
      if (!FLAG_IS_DEFAULT(UseBASE64Intrinsics))
-      warning("Base64 intrinsic requires EVEX instructions on this CPU");
+      warning("Base64 intrinsic requires AVX2 instructions on this CPU");
     FLAG_SET_DEFAULT(UseBASE64Intrinsics, false);
   }
 
@@ -1325,6 +1344,25 @@ void VM_Version::get_processor_features() {
     }
   }
 
+  // Non-temporal stores only pay off for data that would not stay in the
+  // last level cache anyway; the stubs using them rely on movdqu for the
+  // unaligned head of the destination.
+  if (!UseUnalignedLoadStores || UseSSE < 2) {
+    if (NonTemporalStoreThreshold != 0 && !FLAG_IS_DEFAULT(NonTemporalStoreThreshold)) {
+      warning("NonTemporalStoreThreshold requires UseUnalignedLoadStores");
+    }
+    FLAG_SET_DEFAULT(NonTemporalStoreThreshold, 0);
+  } else if (FLAG_IS_DEFAULT(NonTemporalStoreThreshold)) {
+    size_t llc_size = last_level_cache_size();
+    if (llc_size > 0) {
+      FLAG_SET_DEFAULT(NonTemporalStoreThreshold, MIN2(llc_size / 2, (size_t)max_jint));
+    }
+  }
+  if (NonTemporalStoreThreshold != 0 && NonTemporalStoreThreshold < 4 * K) {
+    // The stubs align the destination before the non-temporal loop.
+    FLAG_SET_DEFAULT(NonTemporalStoreThreshold, 4 * K);
+  }
+
 #ifdef _LP64
   if (UseSSE42Intrinsics) {
     if (FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
@@ -1515,6 +1553,7 @@ void VM_Version::get_processor_features() {
     log->print_cr("Logical CPUs per core: %u",
                   logical_processors_per_package());
     log->print_cr("L1 data cache line size: %u", L1_data_cache_line_size());
+    log->print_cr("Last level cache size: " SIZE_FORMAT, last_level_cache_size());
     log->print("UseSSE=%d", (int) UseSSE);
     if (UseAVX > 0) {
       log->print("  UseAVX=%d", (int) UseAVX);
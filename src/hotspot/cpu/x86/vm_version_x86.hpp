@@ -386,6 +386,12 @@ protected:
     uint32_t     dcp_cpuid4_ecx; // unused currently
     uint32_t     dcp_cpuid4_edx; // unused currently
 
+    // cpuid function 4, last valid cache level (last level cache)
+    DcpCpuid4Eax llc_cpuid4_eax;
+    DcpCpuid4Ebx llc_cpuid4_ebx;
+    uint32_t     llc_cpuid4_ecx; // number of sets - 1
+    uint32_t     llc_cpuid4_edx; // unused currently
+
     // cpuid function 7 (structured extended features)
     SefCpuid7Eax sef_cpuid7_eax;
     SefCpuid7Ebx sef_cpuid7_ebx;
@@ -655,6 +661,7 @@ public:
   static ByteSize std_cpuid0_offset() { return byte_offset_of(CpuidInfo, std_max_function); }
   static ByteSize std_cpuid1_offset() { return byte_offset_of(CpuidInfo, std_cpuid1_eax); }
   static ByteSize dcp_cpuid4_offset() { return byte_offset_of(CpuidInfo, dcp_cpuid4_eax); }
+  static ByteSize llc_cpuid4_offset() { return byte_offset_of(CpuidInfo, llc_cpuid4_eax); }
   static ByteSize sef_cpuid7_offset() { return byte_offset_of(CpuidInfo, sef_cpuid7_eax); }
   static ByteSize ext_cpuid1_offset() { return byte_offset_of(CpuidInfo, ext_cpuid1_eax); }
   static ByteSize ext_cpuid5_offset() { return byte_offset_of(CpuidInfo, ext_cpuid5_eax); }
@@ -784,6 +791,17 @@ public:
     return L1_line_size();
   }
 
+  // Size in bytes of the last level cache as reported by the deterministic
+  // cache parameters leaf, or 0 if unknown.
+  static size_t last_level_cache_size() {
+    if (_cpuid_info.llc_cpuid4_eax.bits.cache_type == 0) {
+      return 0;
+    }
+    DcpCpuid4Ebx ebx = _cpuid_info.llc_cpuid4_ebx;
+    return (size_t)(ebx.bits.associativity + 1) * (ebx.bits.partitions + 1) *
+           (ebx.bits.L1_line_size + 1) * (_cpuid_info.llc_cpuid4_ecx + 1);
+  }
+
   //
   // Feature identification
   //
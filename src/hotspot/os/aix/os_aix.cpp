@@ -2309,6 +2309,10 @@ bool os::pd_create_stack_guard_pages(char* addr, size_t size) {
   return true;
 }
 
+bool os::stack_guard_pages_protected(char* addr, size_t size) {
+  return false;
+}
+
 bool os::remove_stack_guard_pages(char* addr, size_t size) {
   // Do not call this; no need to commit stack pages on AIX.
   ShouldNotReachHere();
@@ -59,6 +59,11 @@
   product(bool, UseSHM, false,                                          \
           "Use SYSV shared memory for large pages")                     \
                                                                         \
+  product(uintx, ThreadStackCacheSize, 0,                               \
+          "Number of stacks of exited Java threads kept for reuse "     \
+          "with their guard zones in place (0 disables the cache)")     \
+          range(0, 4096)                                                \
+                                                                        \
   product(bool, UseContainerSupport, true,                              \
           "Enable detection and runtime container configuration support") \
                                                                         \
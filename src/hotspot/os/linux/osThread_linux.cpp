@@ -37,6 +37,9 @@ void OSThread::pd_initialize() {
   _ucontext = NULL;
   _expanding_stack = 0;
   _alt_sig_stack = NULL;
+  _cached_stack = NULL;
+  _cached_stack_size = 0;
+  _cached_stack_guarded = false;
 
   sigemptyset(&_caller_sigmask);
 
@@ -110,6 +110,25 @@ public:
   void set_alt_sig_stack(address val)     { _alt_sig_stack = val; }
   address alt_sig_stack(void)             { return _alt_sig_stack; }
 
+  // Thread stack cache support (see ThreadStackCacheSize). The stack
+  // was allocated by the VM rather than by pthread_create, and goes back
+  // to the cache when the thread exits.
+private:
+  address _cached_stack;                /* low address of the stack, or NULL */
+  size_t _cached_stack_size;
+  bool _cached_stack_guarded;           /* stack guard zone is protected */
+
+public:
+  void set_cached_stack(address stack, size_t size, bool guarded) {
+    _cached_stack = stack;
+    _cached_stack_size = size;
+    _cached_stack_guarded = guarded;
+  }
+  address cached_stack() const            { return _cached_stack; }
+  size_t cached_stack_size() const        { return _cached_stack_size; }
+  bool cached_stack_guarded() const       { return _cached_stack_guarded; }
+  void set_cached_stack_guarded(bool val) { _cached_stack_guarded = val; }
+
 private:
   Monitor* _startThread_lock;     // sync parent and child in thread creation
 
@@ -652,6 +652,115 @@ bool os::Linux::manually_expand_stack(JavaThread * t, address addr) {
   return false;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// thread stack cache
+
+// With ThreadStackCacheSize > 0 the stacks of Java threads are allocated by
+// the VM instead of by glibc. When such a thread exits its stack is kept,
+// with the pages already touched and the stack guard zone still protected,
+// and handed to the next Java thread created with the same stack size. This
+// saves the mmap/munmap of the stack, the page faults to populate it and the
+// mprotect calls to set up and tear down the guard zone.
+//
+// These threads are created joinable: a stack is only reused or unmapped
+// after pthread_join() has confirmed that its previous owner is gone.
+class ThreadStackCache : AllStatic {
+ private:
+  struct Entry {
+    Entry*    _next;
+    address   _stack;
+    size_t    _size;
+    bool      _guarded;
+    pthread_t _owner;
+  };
+
+  static pthread_mutex_t _lock;
+  static Entry*          _head;
+  static uintx           _count;
+
+  static void destroy(Entry* e) {
+    pthread_join(e->_owner, NULL);
+    ThreadStackCache::unmap(e->_stack, e->_size);
+    FREE_C_HEAP_OBJ(e);
+  }
+
+ public:
+  static bool is_enabled_for(os::ThreadType thr_type) {
+    return ThreadStackCacheSize > 0 &&
+           (thr_type == os::java_thread || thr_type == os::compiler_thread);
+  }
+
+  // Returns a stack of exactly 'size' bytes, reusing a cached one if
+  // possible. 'guarded' tells whether the stack guard zone of the returned
+  // stack is still protected.
+  static address acquire(size_t size, bool* guarded) {
+    Entry* e = NULL;
+    pthread_mutex_lock(&_lock);
+    for (Entry** p = &_head; *p != NULL; p = &(*p)->_next) {
+      if ((*p)->_size == size) {
+        e = *p;
+        *p = e->_next;
+        _count--;
+        break;
+      }
+    }
+    pthread_mutex_unlock(&_lock);
+
+    if (e == NULL) {
+      *guarded = false;
+      void* stack = ::mmap(NULL, size, PROT_READ|PROT_WRITE,
+                           MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE|MAP_STACK, -1, 0);
+      return stack == MAP_FAILED ? NULL : (address)stack;
+    }
+
+    // The previous owner may still be running its last few instructions.
+    pthread_join(e->_owner, NULL);
+    address stack = e->_stack;
+    *guarded = e->_guarded;
+    FREE_C_HEAP_OBJ(e);
+    return stack;
+  }
+
+  // Called by an exiting thread to hand its own stack over to the cache.
+  // If the cache is full the oldest entry is evicted.
+  static void release(address stack, size_t size, bool guarded, pthread_t owner) {
+    Entry* e = NEW_C_HEAP_OBJ(Entry, mtThread);
+    e->_stack = stack;
+    e->_size = size;
+    e->_guarded = guarded;
+    e->_owner = owner;
+
+    Entry* evicted = NULL;
+    pthread_mutex_lock(&_lock);
+    e->_next = _head;
+    _head = e;
+    if (++_count > ThreadStackCacheSize) {
+      Entry** p = &_head;
+      while ((*p)->_next != NULL) {
+        p = &(*p)->_next;
+      }
+      evicted = *p;
+      *p = NULL;
+      _count--;
+    }
+    pthread_mutex_unlock(&_lock);
+
+    // Only entries released before ours are evicted, so two exiting
+    // threads never wait for each other.
+    if (evicted != NULL) {
+      destroy(evicted);
+    }
+  }
+
+  static void unmap(address stack, size_t size) {
+    ::munmap(stack, size);
+  }
+};
+
+pthread_mutex_t           ThreadStackCache::_lock  = PTHREAD_MUTEX_INITIALIZER;
+ThreadStackCache::Entry*  ThreadStackCache::_head  = NULL;
+uintx                     ThreadStackCache::_count = 0;
+
 //////////////////////////////////////////////////////////////////////////////
 // create new thread
 
@@ -762,6 +871,21 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
   // Configure glibc guard page.
   pthread_attr_setguardsize(&attr, os::Linux::default_guard_size(thr_type));
 
+  // Run on a stack from the thread stack cache. glibc does not add a
+  // guard page to stacks provided by the caller, but Java threads do not
+  // get one anyway (see default_guard_size()).
+  address cached_stack = NULL;
+  if (ThreadStackCache::is_enabled_for(thr_type)) {
+    bool guarded = false;
+    cached_stack = ThreadStackCache::acquire(stack_size, &guarded);
+    if (cached_stack != NULL) {
+      pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+      status = pthread_attr_setstack(&attr, cached_stack, stack_size);
+      assert_status(status == 0, status, "pthread_attr_setstack");
+      osthread->set_cached_stack(cached_stack, stack_size, guarded);
+    }
+  }
+
   ThreadState state;
 
   {
@@ -781,6 +905,9 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
 
     if (ret != 0) {
       // Need to clean up stuff we've allocated so far
+      if (cached_stack != NULL) {
+        ThreadStackCache::unmap(cached_stack, stack_size);
+      }
       thread->set_osthread(NULL);
       delete osthread;
       return false;
@@ -910,6 +1037,13 @@ void os::free_thread(OSThread* osthread) {
   sigset_t sigmask = osthread->caller_sigmask();
   pthread_sigmask(SIG_SETMASK, &sigmask, NULL);
 
+  // Hand our stack over to the next thread. It is reused only after
+  // this thread has been joined.
+  if (osthread->cached_stack() != NULL) {
+    ThreadStackCache::release(osthread->cached_stack(), osthread->cached_stack_size(),
+                              osthread->cached_stack_guarded(), osthread->pthread_id());
+  }
+
   delete osthread;
 }
 
@@ -3204,6 +3338,17 @@ bool os::pd_create_stack_guard_pages(char* addr, size_t size) {
   return os::commit_memory(addr, size, !ExecMem);
 }
 
+// A stack taken from the thread stack cache still has the guard zone of its
+// previous thread, fully protected (see remove_stack_guard_pages).
+bool os::stack_guard_pages_protected(char* addr, size_t size) {
+  OSThread* osthread = Thread::current()->osthread();
+  assert(!osthread->cached_stack_guarded() ||
+         ((address)addr >= osthread->cached_stack() &&
+          (address)addr + size <= osthread->cached_stack() + osthread->cached_stack_size()),
+         "guard zone must be on the cached stack");
+  return osthread->cached_stack_guarded();
+}
+
 // If this is a growable mapping, remove the guard pages entirely by
 // munmap()ping them.  If not, just call uncommit_memory(). This only
 // affects the main/primordial thread, but guard against future OS changes.
@@ -3217,6 +3362,21 @@ bool os::remove_stack_guard_pages(char* addr, size_t size) {
     return ::munmap(addr, size) == 0;
   }
 
+  Thread* thread = Thread::current();
+  OSThread* osthread = thread->osthread();
+  if (osthread->cached_stack() != NULL) {
+    // The stack goes back to the thread stack cache. Keep the guard zone,
+    // fully protected, for the next thread running on it. It only needs
+    // to be protected again if parts of it are currently disabled.
+    bool guarded = (thread->is_Java_thread() &&
+                    ((JavaThread*)thread)->stack_guards_enabled()) ||
+                   os::guard_memory(addr, size);
+    osthread->set_cached_stack_guarded(guarded);
+    if (guarded) {
+      return true;
+    }
+  }
+
   return os::uncommit_memory(addr, size);
 }
 
@@ -5249,14 +5409,65 @@ void os::set_native_thread_name(const char *name) {
   }
 }
 
+// Hand out the processors this process may run on, taking one from each
+// NUMA node in turn, so that consecutive workers land on different nodes
+// and every node gets its share of the workers.
 bool os::distribute_processes(uint length, uint* distribution) {
-  // Not yet implemented.
-  return false;
+  cpu_set_t mask;
+  if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+    return false;
+  }
+  uint* cpus = NEW_C_HEAP_ARRAY(uint, CPU_SETSIZE, mtInternal);
+  uint* ranks = NEW_C_HEAP_ARRAY(uint, CPU_SETSIZE, mtInternal);
+  int* nodes = NEW_C_HEAP_ARRAY(int, CPU_SETSIZE, mtInternal);
+  uint n = 0;
+  for (uint cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (!CPU_ISSET(cpu, &mask)) {
+      continue;
+    }
+    int node = MAX2(Linux::get_node_by_cpu(cpu), 0);
+    // Rank of this processor among the allowed ones on its node.
+    uint rank = 0;
+    for (uint i = 0; i < n; i++) {
+      if (nodes[i] == node) {
+        rank++;
+      }
+    }
+    // Insertion sort by (rank, node); processors stay in ascending order
+    // within a node.
+    uint pos = n;
+    while (pos > 0 && (ranks[pos - 1] > rank ||
+                       (ranks[pos - 1] == rank && nodes[pos - 1] > node))) {
+      cpus[pos] = cpus[pos - 1];
+      ranks[pos] = ranks[pos - 1];
+      nodes[pos] = nodes[pos - 1];
+      pos--;
+    }
+    cpus[pos] = cpu;
+    ranks[pos] = rank;
+    nodes[pos] = node;
+    n++;
+  }
+  if (n > 0) {
+    for (uint i = 0; i < length; i++) {
+      distribution[i] = cpus[i % n];
+    }
+  }
+  FREE_C_HEAP_ARRAY(int, nodes);
+  FREE_C_HEAP_ARRAY(uint, ranks);
+  FREE_C_HEAP_ARRAY(uint, cpus);
+  return n > 0;
 }
 
 bool os::bind_to_processor(uint processor_id) {
-  // Not yet implemented.
-  return false;
+  if (processor_id >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(processor_id, &mask);
+  // A pid of 0 names the calling thread.
+  return sched_setaffinity(0, sizeof(mask), &mask) == 0;
 }
 
 ///
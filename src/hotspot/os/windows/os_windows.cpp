@@ -3280,6 +3280,10 @@ bool os::pd_create_stack_guard_pages(char* addr, size_t size) {
   return os::commit_memory(addr, size, !ExecMem);
 }
 
+bool os::stack_guard_pages_protected(char* addr, size_t size) {
+  return false;
+}
+
 bool os::remove_stack_guard_pages(char* addr, size_t size) {
   return os::uncommit_memory(addr, size);
 }
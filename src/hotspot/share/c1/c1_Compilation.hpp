@@ -240,6 +240,16 @@ class Compilation: public StackObj {
   bool profile_inlined_calls() {
     return profile_calls() && C1ProfileInlinedCalls;
   }
+  // Branch and call profiles are only updated on one in
+  // C1ProfileSampleInterval executions, with counters scaled to match.
+  bool profile_sampled() {
+    return env()->comp_level() == CompLevel_full_profile &&
+      C1ProfileSampleInterval > 1;
+  }
+  int profile_counter_increment() {
+    return profile_sampled() ? DataLayout::counter_increment * (int)C1ProfileSampleInterval
+                             : DataLayout::counter_increment;
+  }
   bool profile_checkcasts() {
     return env()->comp_level() == CompLevel_full_profile &&
       C1UpdateMethodData && C1ProfileCheckcasts;
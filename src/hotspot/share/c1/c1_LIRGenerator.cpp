@@ -934,7 +934,67 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
+// With C1ProfileSampleInterval > 1 a profile update is only performed when
+// the thread's countdown expires; the skipped executions are accounted for
+// by scaling the counters (see Compilation::profile_counter_increment()).
+// Returns the label to bind after the update, or NULL if every execution
+// is profiled. The countdown kills the condition codes. All values used by
+// the update must have been generated before, since the update is skipped
+// on most executions.
+LabelObj* LIRGenerator::profile_sample_begin() {
+  if (!compilation()->profile_sampled()) {
+    return NULL;
+  }
+  LIR_Address* countdown_addr = new LIR_Address(getThreadPointer(),
+                                                in_bytes(JavaThread::profile_sample_countdown_offset()),
+                                                T_INT);
+  LIR_Opr countdown = new_register(T_INT);
+  LabelObj* L_skip = new LabelObj();
+  __ move(countdown_addr, countdown);
+  __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+  __ move(countdown, countdown_addr);
+  __ cmp(lir_cond_greater, countdown, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_greater, T_INT, L_skip->label());
+
+  // All sites share the countdown. Reset it to the interval plus a
+  // per-thread pseudo-random jitter so that sites executed in a fixed
+  // pattern do not alias with the interval and go unsampled. The jitter
+  // is uniform in [-p/2, p/2) for the largest power of two p <= interval,
+  // which keeps the mean close to the interval the counters are scaled by.
+  const jint interval = (jint)C1ProfileSampleInterval;
+  const jint p = (jint)1 << log2_intptr((uintptr_t)interval);
+  LIR_Address* seed_addr = new LIR_Address(getThreadPointer(),
+                                           in_bytes(JavaThread::profile_sample_seed_offset()),
+                                           T_INT);
+  LIR_Opr seed = new_register(T_INT);
+  LIR_Opr t = new_register(T_INT);
+  __ move(seed_addr, seed);
+  // xorshift32
+  __ move(seed, t);
+  __ shift_left(t, 13, t);
+  __ logical_xor(seed, t, seed);
+  __ move(seed, t);
+  __ unsigned_shift_right(t, 17, t);
+  __ logical_xor(seed, t, seed);
+  __ move(seed, t);
+  __ shift_left(t, 5, t);
+  __ logical_xor(seed, t, seed);
+  __ move(seed, seed_addr);
+  __ logical_and(seed, LIR_OprFact::intConst(p - 1), seed);
+  __ add(seed, LIR_OprFact::intConst(interval - p / 2), seed);
+  __ move(seed, countdown_addr);
+  return L_skip;
+}
+
+void LIRGenerator::profile_sample_end(LabelObj* L_skip) {
+  if (L_skip != NULL) {
+    __ branch_destination(L_skip->label());
+  }
+}
+
+// When profiles are sampled the branch profile must be emitted before the
+// compare of the If, and 'left' and 'right' are compared again here.
+void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != NULL, "method should be set if branch is profiled");
@@ -951,6 +1011,12 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
       not_taken_count_offset = t;
     }
 
+    LabelObj* L_skip = profile_sample_begin();
+    if (L_skip != NULL) {
+      assert(left->is_valid() && right->is_valid(), "need the operands to recompute the condition");
+      __ cmp(lir_cond(cond), left, right);
+    }
+
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
@@ -965,9 +1031,10 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
     // Use leal instead of add to avoid destroying condition codes on x86
-    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
+    LIR_Address* fake_incr_value = new LIR_Address(data_reg, compilation()->profile_counter_increment(), T_INT);
     __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
     __ move(data_reg, data_addr);
+    profile_sample_end(L_skip);
   }
 }
 
@@ -2339,6 +2406,7 @@ void LIRGenerator::do_TableSwitch(TableSwitch* x) {
     assert(data != NULL, "must have profiling data");
     assert(data->is_MultiBranchData(), "bad profile data?");
     int default_count_offset = md->byte_offset_of_slot(data, MultiBranchData::default_count_offset());
+    LabelObj* L_skip = profile_sample_begin();
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
     LIR_Opr data_offset_reg = new_pointer_register();
@@ -2358,8 +2426,9 @@ void LIRGenerator::do_TableSwitch(TableSwitch* x) {
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
-    __ add(data_reg, LIR_OprFact::intptrConst(1), data_reg);
+    __ add(data_reg, LIR_OprFact::intptrConst(compilation()->profile_counter_increment()), data_reg);
     __ move(data_reg, data_addr);
+    profile_sample_end(L_skip);
   }
 
   if (UseTableRanges) {
@@ -2397,6 +2466,7 @@ void LIRGenerator::do_LookupSwitch(LookupSwitch* x) {
     assert(data != NULL, "must have profiling data");
     assert(data->is_MultiBranchData(), "bad profile data?");
     int default_count_offset = md->byte_offset_of_slot(data, MultiBranchData::default_count_offset());
+    LabelObj* L_skip = profile_sample_begin();
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
     LIR_Opr data_offset_reg = new_pointer_register();
@@ -2416,8 +2486,9 @@ void LIRGenerator::do_LookupSwitch(LookupSwitch* x) {
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
-    __ add(data_reg, LIR_OprFact::intptrConst(1), data_reg);
+    __ add(data_reg, LIR_OprFact::intptrConst(compilation()->profile_counter_increment()), data_reg);
     __ move(data_reg, data_addr);
+    profile_sample_end(L_skip);
   }
 
   if (UseTableRanges) {
@@ -2476,11 +2547,13 @@ void LIRGenerator::do_Goto(Goto* x) {
       assert(data->is_JumpData(), "need JumpData for branches");
       offset = md->byte_offset_of_slot(data, JumpData::taken_offset());
     }
+    LabelObj* L_skip = profile_sample_begin();
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
     increment_counter(new LIR_Address(md_reg, offset,
-                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), compilation()->profile_counter_increment());
+    profile_sample_end(L_skip);
   }
 
   // emit phi-instruction move after safepoint since this simplifies
@@ -3222,6 +3295,22 @@ void LIRGenerator::do_ProfileCall(ProfileCall* x) {
   // tmp is used to hold the counters on SPARC
   LIR_Opr tmp = new_pointer_register();
 
+  if (compilation()->profile_sampled()) {
+    // Generate the receiver and the profiled arguments ahead of the sampled
+    // region. A value generated first inside it (e.g. a constant loaded
+    // into a register cached for the block) would be undefined on the
+    // skip path, where the invoke still uses it.
+    if (x->recv() != NULL) {
+      LIRItem value(x->recv(), this);
+      value.load_item();
+    }
+    for (int i = 0; i < x->nb_profiled_args(); i++) {
+      LIRItem value(x->profiled_arg_at(i), this);
+      value.load_item();
+    }
+  }
+
+  LabelObj* L_skip = profile_sample_begin();
   if (x->nb_profiled_args() > 0) {
     profile_arguments(x);
   }
@@ -3238,6 +3327,7 @@ void LIRGenerator::do_ProfileCall(ProfileCall* x) {
     __ move(value.result(), recv);
   }
   __ profile_call(x->method(), x->bci_of_invoke(), x->callee(), mdo, recv, tmp, x->known_holder());
+  profile_sample_end(L_skip);
 }
 
 void LIRGenerator::do_ProfileReturnType(ProfileReturnType* x) {
@@ -3249,6 +3339,12 @@ void LIRGenerator::do_ProfileReturnType(ProfileReturnType* x) {
     assert(data->is_CallTypeData() || data->is_VirtualCallTypeData(), "wrong profile data type");
     ciReturnTypeEntry* ret = data->is_CallTypeData() ? ((ciCallTypeData*)data)->ret() : ((ciVirtualCallTypeData*)data)->ret();
     LIR_Opr mdp = LIR_OprFact::illegalOpr;
+    if (compilation()->profile_sampled()) {
+      // Generate the returned value ahead of the sampled region
+      LIRItem value(x->ret(), this);
+      value.load_item();
+    }
+    LabelObj* L_skip = profile_sample_begin();
 
     bool ignored_will_link;
     ciSignature* signature_at_call = NULL;
@@ -3265,6 +3361,7 @@ void LIRGenerator::do_ProfileReturnType(ProfileReturnType* x) {
     if (exact != NULL) {
       md->set_return_type(bci, exact);
     }
+    profile_sample_end(L_skip);
   }
 }
 
@@ -321,6 +321,13 @@
   product(bool, C1UpdateMethodData, trueInTiered,                           \
           "Update MethodData*s in Tier1-generated code")                    \
                                                                             \
+  product(intx, C1ProfileSampleInterval, 1,                                 \
+          "Update branch and call profiles in Tier3-generated code on "     \
+          "about one in this many executions (with random jitter) and "     \
+          "scale the counters by it; "                                      \
+          "1 profiles every execution")                                     \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(bool, PrintCFGToFile, false,                                      \
           "print control flow graph to a separate file during compilation") \
                                                                             \
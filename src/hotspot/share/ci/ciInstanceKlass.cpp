@@ -213,6 +213,13 @@ ciInstanceKlass* ciInstanceKlass::get_canonical_holder(int offset) {
   }
 
   ciInstanceKlass* self = this;
+  // Fields of a subclass may be allocated in gaps of its super's layout
+  // (see UseNewFieldLayout), so look the field up first.
+  assert(self->is_loaded(), "must be loaded to access field info");
+  ciField* field = self->get_field_by_offset(offset, false);
+  if (field != NULL) {
+    return field->holder();
+  }
   for (;;) {
     assert(self->is_loaded(), "must be loaded to have size");
     ciInstanceKlass* super = self->super();
@@ -462,7 +469,9 @@ int ciInstanceKlass::compute_nonstatic_fields() {
     super_fields = super->_nonstatic_fields;
     assert(super_flen == 0 || super_fields != NULL, "first get nof_fields");
     // See if I am no larger than my super; if so, I can use his fields.
-    if (fsize == super_fsize) {
+    // With UseNewFieldLayout my fields may live in gaps of the super's
+    // layout, so the size alone does not tell.
+    if (fsize == super_fsize && !UseNewFieldLayout) {
       _nonstatic_fields = super_fields;
       return super_fields->length();
     }
@@ -300,6 +300,24 @@ address ciMethod::native_entry() {
 }
 
 
+// ------------------------------------------------------------------
+// ciMethod::trivial_native_entry
+//
+// Get the address of this method's trivial native function, if it
+// is bound and has one. It is resolved when the method is bound
+// (see Method::set_native_function).
+address ciMethod::trivial_native_entry() {
+  check_is_loaded();
+  assert(flags().is_native(), "must be native method");
+  VM_ENTRY_MARK;
+  Method* method = get_Method();
+  if (!method->has_native_function()) {
+    return NULL;
+  }
+  return method->trivial_native_function();
+}
+
+
 // ------------------------------------------------------------------
 // ciMethod::interpreter_entry
 //
@@ -217,6 +217,7 @@ class ciMethod : public ciMetadata {
   // Runtime information.
   int           vtable_index();
   address       native_entry();
+  address       trivial_native_entry();
   address       interpreter_entry();
 
   // Analysis and profiling.
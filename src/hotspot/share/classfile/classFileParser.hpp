@@ -42,9 +42,37 @@ class FieldInfo;
 template <typename T>
 class GrowableArray;
 class InstanceKlass;
+class OopMapBlock;
+class outputStream;
 class Symbol;
 class TempNewSymbol;
 
+// Utility to collect and compact oop maps during layout
+class OopMapBlocksBuilder : public ResourceObj {
+ public:
+  OopMapBlock* _nonstatic_oop_maps;
+  unsigned int _nonstatic_oop_map_count;
+  unsigned int _max_nonstatic_oop_maps;
+
+  OopMapBlocksBuilder(unsigned int max_blocks);
+  OopMapBlock* last_oop_map() const;
+  void initialize_inherited_blocks(OopMapBlock* blocks, unsigned int nof_blocks);
+  void add(int offset, int count);
+  void copy(OopMapBlock* dst);
+  void compact();
+  void print_on(outputStream* st) const;
+};
+
+// Values needed for oopmap and InstanceKlass creation
+class FieldLayoutInfo : public ResourceObj {
+ public:
+  OopMapBlocksBuilder* oop_map_blocks;
+  int  instance_size;
+  int  nonstatic_field_size;
+  int  static_field_size;
+  bool has_nonstatic_fields;
+};
+
 // Parser for for .class files
 //
 // The bytes describing the class file structure is read from a Stream object
@@ -54,7 +82,6 @@ class ClassFileParser {
  class ClassAnnotationCollector;
  class FieldAllocationCount;
  class FieldAnnotationCollector;
- class FieldLayoutInfo;
 
  public:
   // The ClassFileParser has an associated "publicity" level
@@ -489,6 +516,10 @@ class ClassFileParser {
                                int annotation_default_length,
                                TRAPS);
 
+  // Classes whose field offsets are hard-coded in the VM and must keep
+  // the legacy layout
+  bool has_hard_coded_field_offsets() const;
+
   // lays out fields in class and returns the total oopmap count
   void layout_fields(ConstantPool* cp,
                      const FieldAllocationCount* fac,
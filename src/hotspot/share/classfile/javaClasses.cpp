@@ -28,10 +28,12 @@
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/stringTable.hpp"
+#include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "code/debugInfo.hpp"
 #include "code/dependencyContext.hpp"
 #include "code/pcDesc.hpp"
+#include "gc/shared/oopStorage.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/linkResolver.hpp"
 #include "logging/log.hpp"
@@ -2160,6 +2162,136 @@ class BacktraceIterator : public StackObj {
   }
 };
 
+// A frame of a stack trace, recorded before the backtrace is built.
+struct BacktraceFrame {
+  Method* _method;
+  int     _bci;
+  BacktraceFrame() : _method(NULL), _bci(0) {}
+  BacktraceFrame(Method* method, int bci) : _method(method), _bci(bci) {}
+};
+
+// Throwables created over and over at the same place have identical stack
+// traces. BacktraceCache remembers recently built backtraces, indexed by a
+// hash of their frames, so that such throwables can share one backtrace
+// instead of allocating their own. Since the backtrace also caches its
+// StackTraceElements (see get_stack_trace_elements), printing them is
+// shared as well.
+//
+// The cache is a direct mapped table of weak references. Entries are
+// updated without locking: a racy or stale entry only causes a miss,
+// because a candidate backtrace is compared frame by frame before use.
+class BacktraceCache : AllStatic {
+ private:
+  enum {
+    table_size = 1024   // must be a power of 2
+  };
+
+  struct Entry {
+    volatile unsigned int _hash;
+    oop* volatile         _backtrace;   // weak, in vm_weak_oop_storage()
+  };
+
+  static Entry _table[table_size];
+
+  static Entry* entry_for(unsigned int hash) {
+    return &_table[hash & (table_size - 1)];
+  }
+
+  static bool matches(objArrayOop chunk, GrowableArray<BacktraceFrame>* frames);
+
+ public:
+  static unsigned int hash(unsigned int hash, Method* method, int bci) {
+    return 31 * hash + (unsigned int)((uintptr_t)method >> LogBytesPerWord) + (unsigned int)bci;
+  }
+  static oop lookup(unsigned int hash, GrowableArray<BacktraceFrame>* frames);
+  static void insert(unsigned int hash, oop backtrace);
+  static void flush();
+};
+
+BacktraceCache::Entry BacktraceCache::_table[BacktraceCache::table_size];
+
+bool BacktraceCache::matches(objArrayOop chunk, GrowableArray<BacktraceFrame>* frames) {
+  NoSafepointVerifier nsv;
+  typeArrayOop methods = typeArrayOop(chunk->obj_at(java_lang_Throwable::trace_methods_offset));
+  typeArrayOop bcis = typeArrayOop(chunk->obj_at(java_lang_Throwable::trace_bcis_offset));
+  objArrayOop mirrors = objArrayOop(chunk->obj_at(java_lang_Throwable::trace_mirrors_offset));
+  int index = 0;
+  for (int i = 0; i < frames->length(); i++) {
+    if (index >= java_lang_Throwable::trace_chunk_size) {
+      chunk = objArrayOop(chunk->obj_at(java_lang_Throwable::trace_next_offset));
+      if (chunk == NULL) {
+        return false;
+      }
+      methods = typeArrayOop(chunk->obj_at(java_lang_Throwable::trace_methods_offset));
+      bcis = typeArrayOop(chunk->obj_at(java_lang_Throwable::trace_bcis_offset));
+      mirrors = objArrayOop(chunk->obj_at(java_lang_Throwable::trace_mirrors_offset));
+      index = 0;
+    }
+    Method* method = frames->at(i)._method;
+    int bci = frames->at(i)._bci;
+    if (methods->ushort_at(index) != method->orig_method_idnum() ||
+        bcis->int_at(index) != Backtrace::merge_bci_and_version(bci, method->constants()->version()) ||
+        !oopDesc::equals(mirrors->obj_at(index), method->method_holder()->java_mirror())) {
+      return false;
+    }
+    index++;
+  }
+  // The backtrace must not have more frames.
+  if (index >= java_lang_Throwable::trace_chunk_size) {
+    chunk = objArrayOop(chunk->obj_at(java_lang_Throwable::trace_next_offset));
+    return chunk == NULL ||
+           objArrayOop(chunk->obj_at(java_lang_Throwable::trace_mirrors_offset))->obj_at(0) == NULL;
+  }
+  return mirrors->obj_at(index) == NULL;
+}
+
+oop BacktraceCache::lookup(unsigned int hash, GrowableArray<BacktraceFrame>* frames) {
+  Entry* entry = entry_for(hash);
+  if (OrderAccess::load_acquire(&entry->_hash) != hash) {
+    return NULL;
+  }
+  oop* slot = OrderAccess::load_acquire(&entry->_backtrace);
+  if (slot == NULL) {
+    return NULL;
+  }
+  oop backtrace = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(slot);
+  if (backtrace == NULL || !matches(objArrayOop(backtrace), frames)) {
+    return NULL;
+  }
+  return backtrace;
+}
+
+void BacktraceCache::insert(unsigned int hash, oop backtrace) {
+  Entry* entry = entry_for(hash);
+  oop* slot = OrderAccess::load_acquire(&entry->_backtrace);
+  if (slot == NULL) {
+    OopStorage* storage = SystemDictionary::vm_weak_oop_storage();
+    slot = storage->allocate();
+    if (slot == NULL) {
+      return; // Not worth failing for, just don't cache
+    }
+    oop* prev = Atomic::cmpxchg(slot, &entry->_backtrace, (oop*)NULL);
+    if (prev != NULL) {
+      // Another thread installed the slot first.
+      storage->release(slot);
+      slot = prev;
+    }
+  }
+  NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(slot, backtrace);
+  OrderAccess::release_store(&entry->_hash, hash);
+}
+
+void BacktraceCache::flush() {
+  assert_at_safepoint();
+  for (int i = 0; i < table_size; i++) {
+    Entry* entry = &_table[i];
+    entry->_hash = 0;
+    if (entry->_backtrace != NULL) {
+      NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(entry->_backtrace, oop(NULL));
+    }
+  }
+}
+
 
 // Print stack trace element to resource allocated buffer
 static void print_stack_element_to_stream(outputStream* st, Handle mirror, int method_id,
@@ -2320,12 +2452,11 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
   int max_depth = MaxJavaStackTraceDepth;
   JavaThread* thread = (JavaThread*)THREAD;
 
-  BacktraceBuilder bt(CHECK);
-
   // If there is no Java frame just return the method that was being called
   // with bci 0
   if (!thread->has_last_Java_frame()) {
     if (max_depth >= 1 && method() != NULL) {
+      BacktraceBuilder bt(CHECK);
       bt.push(method(), 0, CHECK);
       log_info(stacktrace)("%s, %d", throwable->klass()->external_name(), 1);
       set_depth(throwable(), 1);
@@ -2352,6 +2483,11 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
   bool skip_throwableInit_check = false;
   bool skip_hidden = !ShowHiddenFrames;
 
+  // The frames are recorded first, so that an identical backtrace built
+  // earlier can be shared instead of allocating a new one.
+  GrowableArray<BacktraceFrame> frames(max_depth == 0 || max_depth > 64 ? 64 : max_depth);
+  unsigned int hash = 0;
+
   for (frame fr = thread->last_frame(); max_depth == 0 || max_depth != total_count;) {
     Method* method = NULL;
     int bci = 0;
@@ -2432,12 +2568,32 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
     if (method->is_hidden()) {
       if (skip_hidden)  continue;
     }
-    bt.push(method, bci, CHECK);
+    // Smear the -1 bci to 0 like BacktraceBuilder::push does.
+    if (bci == SynchronizationEntryBCI) bci = 0;
+    frames.append(BacktraceFrame(method, bci));
+    hash = BacktraceCache::hash(hash, method, bci);
     total_count++;
   }
 
   log_info(stacktrace)("%s, %d", throwable->klass()->external_name(), total_count);
 
+  if (ShareThrowableBacktraces) {
+    oop shared = BacktraceCache::lookup(hash, &frames);
+    if (shared != NULL) {
+      set_backtrace(throwable(), shared);
+      set_depth(throwable(), total_count);
+      return;
+    }
+  }
+
+  BacktraceBuilder bt(CHECK);
+  for (int i = 0; i < frames.length(); i++) {
+    bt.push(frames.at(i)._method, frames.at(i)._bci, CHECK);
+  }
+  if (ShareThrowableBacktraces) {
+    BacktraceCache::insert(hash, bt.backtrace());
+  }
+
   // Put completed stack trace into throwable object
   set_backtrace(throwable(), bt.backtrace());
   set_depth(throwable(), total_count);
@@ -2490,6 +2646,9 @@ void java_lang_Throwable::fill_in_stack_trace_of_preallocated_backtrace(Handle t
 
   BacktraceBuilder bt(THREAD, backtrace);
 
+  // The preallocated backtrace is refilled, drop its StackTraceElements.
+  backtrace->obj_at_put(trace_elements_offset, NULL);
+
   // Unlike fill_in_stack_trace we do not skip fillInStackTrace or throwable init
   // methods as preallocated errors aren't created by "java" code.
 
@@ -2524,6 +2683,24 @@ void java_lang_Throwable::get_stack_trace_elements(Handle throwable,
   }
 
   objArrayHandle result(THREAD, objArrayOop(backtrace(throwable())));
+
+  // StackTraceElements are immutable once initialized, so those already
+  // created for this backtrace (which may be shared by several throwables)
+  // are reused rather than looking up names and line numbers again.
+  // Elements cached before a class redefinition may describe old method
+  // versions, so none are cached or reused once a class was redefined.
+  const bool share_elements = ShareThrowableBacktraces &&
+                              !JvmtiExport::has_redefined_a_class();
+  if (share_elements && result.not_null()) {
+    objArrayOop elements = objArrayOop(result->obj_at(trace_elements_offset));
+    if (elements != NULL && elements->length() == stack_trace_array_h->length()) {
+      for (int i = 0; i < elements->length(); i++) {
+        stack_trace_array_h->obj_at_put(i, elements->obj_at(i));
+      }
+      return;
+    }
+  }
+
   BacktraceIterator iter(result, THREAD);
 
   int index = 0;
@@ -2545,6 +2722,18 @@ void java_lang_Throwable::get_stack_trace_elements(Handle throwable,
                                          bte._bci,
                                          bte._name, CHECK);
   }
+
+  if (share_elements && result.not_null()) {
+    result->obj_at_put(trace_elements_offset, stack_trace_array_h());
+  }
+}
+
+// Called at the end of class redefinition: cached backtraces may describe
+// the old versions of the redefined methods.
+void java_lang_Throwable::flush_shared_backtraces() {
+  if (ShareThrowableBacktraces) {
+    BacktraceCache::flush();
+  }
 }
 
 oop java_lang_StackTraceElement::create(const methodHandle& method, int bci, TRAPS) {
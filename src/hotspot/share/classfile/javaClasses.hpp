@@ -494,6 +494,7 @@ class java_lang_ThreadGroup : AllStatic {
 class java_lang_Throwable: AllStatic {
   friend class BacktraceBuilder;
   friend class BacktraceIterator;
+  friend class BacktraceCache;
 
  private:
   // Offsets
@@ -505,13 +506,14 @@ class java_lang_Throwable: AllStatic {
   };
   // Trace constants
   enum {
-    trace_methods_offset = 0,
-    trace_bcis_offset    = 1,
-    trace_mirrors_offset = 2,
-    trace_names_offset   = 3,
-    trace_next_offset    = 4,
-    trace_size           = 5,
-    trace_chunk_size     = 32
+    trace_methods_offset  = 0,
+    trace_bcis_offset     = 1,
+    trace_mirrors_offset  = 2,
+    trace_names_offset    = 3,
+    trace_next_offset     = 4,
+    trace_elements_offset = 5,  // cached StackTraceElements, first chunk only
+    trace_size            = 6,
+    trace_chunk_size      = 32
   };
 
   static int backtrace_offset;
@@ -554,6 +556,7 @@ class java_lang_Throwable: AllStatic {
   static void fill_in_stack_trace(Handle throwable, const methodHandle& method = methodHandle());
   // Programmatic access to stack trace
   static void get_stack_trace_elements(Handle throwable, objArrayHandle stack_trace, TRAPS);
+  static void flush_shared_backtraces();
   // Printing
   static void print(oop throwable, outputStream* st);
   static void print_stack_trace(Handle throwable, outputStream* st);
@@ -1158,6 +1158,8 @@ NOT_PRODUCT(static elapsedTimer dependentCheckTime;)
 int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   int number_of_marked_CodeBlobs = 0;
+  int number_of_contexts = 0;
+  jlong start = log_is_enabled(Debug, dependencies) ? os::javaTimeNanos() : 0;
 
   // search the hierarchy looking for nmethods which are affected by the loading of this class
 
@@ -1170,6 +1172,17 @@ int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     Klass* d = str.klass();
     number_of_marked_CodeBlobs += InstanceKlass::cast(d)->mark_dependent_nmethods(changes);
+    number_of_contexts++;
+  }
+
+  if (log_is_enabled(Debug, dependencies)) {
+    ResourceMark rm;
+    jlong elapsed = os::javaTimeNanos() - start;
+    log_debug(dependencies)("Checked dependencies for %s: %d contexts, %d nmethods checked, %d skipped, %d marked, "
+                            JLONG_FORMAT " us",
+                            changes.new_type()->external_name(), number_of_contexts,
+                            changes.checked_nmethods(), changes.skipped_nmethods(),
+                            number_of_marked_CodeBlobs, elapsed / (NANOUNITS / MICROUNITS));
   }
 
 #ifndef PRODUCT
@@ -1326,7 +1339,7 @@ void CodeCache::flush_evol_dependents_on(InstanceKlass* ev_k) {
 
 // Flushes compiled methods dependent on dependee
 void CodeCache::flush_dependents_on_method(const methodHandle& m_h) {
-  // --- Compile_lock is not held. However we are at a safepoint.
+  // Either Compile_lock is held or we are at a safepoint.
   assert_locked_or_safepoint(Compile_lock);
 
   // CodeCache can only be updated by a thread_in_VM and they will all be
@@ -1336,6 +1349,11 @@ void CodeCache::flush_dependents_on_method(const methodHandle& m_h) {
   // Compute the dependent nmethods
   if (mark_for_deoptimization(m_h()) > 0) {
     // At least one nmethod has been marked for deoptimization
+    if (!SafepointSynchronize::is_at_safepoint()) {
+      VM_Deoptimize op;
+      VMThread::execute(&op);
+      return;
+    }
 
     // All this already happens inside a VM_Operation, so we'll do all the work here.
     // Stuff copied from VM_Deoptimize and modified slightly.
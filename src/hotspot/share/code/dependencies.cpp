@@ -2042,6 +2042,16 @@ KlassDepChange::~KlassDepChange() {
   }
 }
 
+int KlassDepChange::affected_dependency_types() {
+  // A new type cannot break evol_method or call site dependencies, and it
+  // only breaks no_finalizable_subclasses if it needs finalization itself.
+  int types = Dependencies::klass_types & ~Dependencies::non_ctxk_types;
+  if (!new_type()->has_finalizer()) {
+    types &= ~(1 << Dependencies::no_finalizable_subclasses);
+  }
+  return types;
+}
+
 bool KlassDepChange::involves_context(Klass* k) {
   if (k == NULL || !k->is_instance_klass()) {
     return false;
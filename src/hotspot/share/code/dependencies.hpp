@@ -672,6 +672,14 @@ class DependencySignature : public ResourceObj {
 
 // Every particular DepChange is a sub-class of this class.
 class DepChange : public StackObj {
+ private:
+  // statistics for -Xlog:dependencies
+  int _checked_nmethods;   // dependent nmethods whose dependencies were evaluated
+  int _skipped_nmethods;   // dependent nmethods rejected by their dependency types
+
+ protected:
+  DepChange() : _checked_nmethods(0), _skipped_nmethods(0) {}
+
  public:
   // What kind of DepChange is this?
   virtual bool is_klass_change()     const { return false; }
@@ -679,6 +687,14 @@ class DepChange : public StackObj {
 
   virtual void mark_for_deoptimization(nmethod* nm) = 0;
 
+  // Bit mask of the Dependencies::DepType values this change may invalidate.
+  virtual int affected_dependency_types() = 0;
+
+  void note_checked_nmethod()   { _checked_nmethods++; }
+  void note_skipped_nmethod()   { _skipped_nmethods++; }
+  int  checked_nmethods() const { return _checked_nmethods; }
+  int  skipped_nmethods() const { return _skipped_nmethods; }
+
   // Subclass casting with assertions.
   KlassDepChange*    as_klass_change() {
     assert(is_klass_change(), "bad cast");
@@ -772,6 +788,8 @@ class KlassDepChange : public DepChange {
     nm->mark_for_deoptimization(/*inc_recompile_counts=*/true);
   }
 
+  virtual int affected_dependency_types();
+
   Klass* new_type() { return _new_type; }
 
   // involves_context(k) is true if k is new_type or any of the super types
@@ -795,6 +813,10 @@ class CallSiteDepChange : public DepChange {
     nm->mark_for_deoptimization(/*inc_recompile_counts=*/false);
   }
 
+  virtual int affected_dependency_types() {
+    return 1 << Dependencies::call_site_target_value;
+  }
+
   oop call_site()     const { return _call_site();     }
   oop method_handle() const { return _method_handle(); }
 };
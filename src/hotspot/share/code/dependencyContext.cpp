@@ -62,13 +62,26 @@ void DependencyContext::init() {
 // are dependent on the changes that were passed in and mark them for
 // deoptimization.  Returns the number of nmethods found.
 //
-int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
+// If 'context' is given, this is the dependency context of that klass
+// and only the dependencies of each nmethod on it are checked: the
+// caller visits the contexts of all other klasses involved in the change.
+//
+int DependencyContext::mark_dependent_nmethods(DepChange& changes, Klass* context) {
   int found = 0;
+  int affected_types = changes.affected_dependency_types();
   for (nmethodBucket* b = dependencies_not_unloading(); b != NULL; b = b->next_not_unloading()) {
     nmethod* nm = b->get_nmethod();
     // since dependencies aren't removed until an nmethod becomes a zombie,
     // the dependency list may contain nmethods which aren't alive.
-    if (b->count() > 0 && nm->is_alive() && !nm->is_marked_for_deoptimization() && nm->check_dependency_on(changes)) {
+    if (b->count() <= 0 || !nm->is_alive() || nm->is_marked_for_deoptimization()) {
+      continue;
+    }
+    if ((b->dependency_types() & affected_types) == 0) {
+      changes.note_skipped_nmethod();
+      continue;
+    }
+    changes.note_checked_nmethod();
+    if (nm->check_dependency_on(changes, context)) {
       if (TraceDependencies) {
         ResourceMark rm;
         tty->print_cr("Marked for deoptimization");
@@ -89,15 +102,15 @@ int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
 // so a count is kept for each bucket to guarantee that creation and
 // deletion of dependencies is consistent.
 //
-void DependencyContext::add_dependent_nmethod(nmethod* nm) {
+void DependencyContext::add_dependent_nmethod(nmethod* nm, int dependency_types) {
   assert_lock_strong(CodeCache_lock);
   for (nmethodBucket* b = dependencies_not_unloading(); b != NULL; b = b->next_not_unloading()) {
     if (nm == b->get_nmethod()) {
-      b->increment();
+      b->increment(dependency_types);
       return;
     }
   }
-  nmethodBucket* new_head = new nmethodBucket(nm, NULL);
+  nmethodBucket* new_head = new nmethodBucket(nm, dependency_types, NULL);
   for (;;) {
     nmethodBucket* head = Atomic::load(_dependency_context_addr);
     new_head->set_next(head);
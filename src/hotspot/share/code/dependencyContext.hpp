@@ -33,6 +33,7 @@
 
 class nmethod;
 class DepChange;
+class Klass;
 
 //
 // nmethodBucket is used to record dependent nmethods for
@@ -44,20 +45,27 @@ class DepChange;
 // noticed since an nmethod should be removed as many times are it's
 // added.
 //
+// The bucket also records the set of dependency types (a bit mask of
+// Dependencies::DepType) the nmethod has on the context, so that a change
+// which cannot invalidate any of them skips the nmethod without decoding
+// its dependencies.
+//
 class nmethodBucket: public CHeapObj<mtClass> {
   friend class VMStructs;
  private:
   nmethod*       _nmethod;
   volatile int   _count;
+  int            _dependency_types;
   nmethodBucket* volatile _next;
   nmethodBucket* volatile _purge_list_next;
 
  public:
-  nmethodBucket(nmethod* nmethod, nmethodBucket* next) :
-    _nmethod(nmethod), _count(1), _next(next), _purge_list_next(NULL) {}
+  nmethodBucket(nmethod* nmethod, int dependency_types, nmethodBucket* next) :
+    _nmethod(nmethod), _count(1), _dependency_types(dependency_types), _next(next), _purge_list_next(NULL) {}
 
   int count()                                { return _count; }
-  int increment()                            { _count += 1; return _count; }
+  int increment(int dependency_types)        { _dependency_types |= dependency_types; _count += 1; return _count; }
+  int dependency_types()                     { return _dependency_types; }
   int decrement();
   nmethodBucket* next();
   nmethodBucket* next_not_unloading();
@@ -117,8 +125,8 @@ class DependencyContext : public StackObj {
 
   static void init();
 
-  int  mark_dependent_nmethods(DepChange& changes);
-  void add_dependent_nmethod(nmethod* nm);
+  int  mark_dependent_nmethods(DepChange& changes, Klass* context = NULL);
+  void add_dependent_nmethod(nmethod* nm, int dependency_types);
   void remove_dependent_nmethod(nmethod* nm);
   int  remove_all_dependents();
   void clean_unloading_dependents();
@@ -537,7 +537,7 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
             continue;  // ignore things like evol_method
           }
           // record this nmethod as dependent on this klass
-          InstanceKlass::cast(klass)->add_dependent_nmethod(nm);
+          InstanceKlass::cast(klass)->add_dependent_nmethod(nm, 1 << deps.type());
         }
       }
       NOT_PRODUCT(if (nm != NULL)  note_java_nmethod(nm));
@@ -2014,12 +2014,15 @@ void nmethod::check_all_dependencies(DepChange& changes) {
   }
 }
 
-bool nmethod::check_dependency_on(DepChange& changes) {
+bool nmethod::check_dependency_on(DepChange& changes, Klass* context) {
   // What has happened:
   // 1) a new class dependee has been added
   // 2) dependee and all its super classes have been marked
   bool found_check = false;  // set true if we are upset
   for (Dependencies::DepStream deps(this); deps.next(); ) {
+    if (context != NULL && deps.context_type() != context) {
+      continue;  // checked when the other context is visited
+    }
     // Evaluate only relevant dependencies.
     if (deps.spot_check_dependency_at(changes) != NULL) {
       found_check = true;
@@ -584,7 +584,7 @@ public:
 
   // tells if this compiled method is dependent on the given changes,
   // and the changes have invalidated it
-  bool check_dependency_on(DepChange& changes);
+  bool check_dependency_on(DepChange& changes, Klass* context = NULL);
 
   // Evolution support. Tells if this compiled method is dependent on any of
   // methods m() of class dependee, such that if m() in dependee is replaced,
@@ -903,9 +903,12 @@ void CompileBroker::possibly_add_compiler_threads() {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  // The thread counts are chosen for os::max_active_processor_count(); only
+  // start the share that matches the currently active processors.
+
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN4((int)os::scale_to_active_processors(_c2_count),
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
@@ -925,7 +928,7 @@ void CompileBroker::possibly_add_compiler_threads() {
 
   if (_c1_compile_queue != NULL) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN4((int)os::scale_to_active_processors(_c1_count),
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
@@ -341,6 +341,15 @@ bool CompilerConfig::check_args_consistency(bool status) {
   }
 #endif // COMPILER2
 
+#ifdef COMPILER1
+#ifndef AMD64
+  if (C1ProfileSampleInterval > 1) {
+    warning("C1ProfileSampleInterval is not supported on this platform; profiling every execution.");
+    FLAG_SET_CMDLINE(intx, C1ProfileSampleInterval, 1);
+  }
+#endif
+#endif
+
   if (Arguments::is_interpreter_only()) {
     if (UseCompiler) {
       if (!FLAG_IS_DEFAULT(UseCompiler)) {
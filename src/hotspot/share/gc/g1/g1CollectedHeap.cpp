@@ -2223,6 +2223,26 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+class G1ParallelObjectIterator : public ParallelObjectIterator {
+ private:
+  G1CollectedHeap*  _heap;
+  HeapRegionClaimer _claimer;
+
+ public:
+  G1ParallelObjectIterator(uint thread_num) :
+    _heap(G1CollectedHeap::heap()),
+    _claimer(thread_num == 0 ? G1CollectedHeap::heap()->workers()->active_workers() : thread_num) {}
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    IterateObjectClosureRegionClosure blk(cl);
+    _heap->heap_region_par_iterate_from_worker_offset(&blk, &_claimer, worker_id);
+  }
+};
+
+ParallelObjectIterator* G1CollectedHeap::parallel_object_iterator(uint thread_num) {
+  return new G1ParallelObjectIterator(thread_num);
+}
+
 void G1CollectedHeap::heap_region_iterate(HeapRegionClosure* cl) const {
   _hrm->iterate(cl);
 }
@@ -3167,6 +3187,7 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
 
     TASKQUEUE_STATS_ONLY(print_taskqueue_stats());
     TASKQUEUE_STATS_ONLY(reset_taskqueue_stats());
+    _task_queues->log_numa_steal_stats("Evacuation");
 
     print_heap_after_gc();
     print_heap_regions();
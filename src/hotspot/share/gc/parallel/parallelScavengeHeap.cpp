@@ -35,12 +35,14 @@
 #include "gc/parallel/psMarkSweepProxy.hpp"
 #include "gc/parallel/psMemoryPool.hpp"
 #include "gc/parallel/psParallelCompact.inline.hpp"
+#include "gc/parallel/psPeriodicGCThread.hpp"
 #include "gc/parallel/psPromotionManager.hpp"
 #include "gc/parallel/psScavenge.hpp"
 #include "gc/parallel/psVMOperations.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/gcWhen.hpp"
+#include "gc/shared/spaceDecorator.hpp"
 #include "logging/log.hpp"
 #include "memory/metaspaceCounters.hpp"
 #include "oops/oop.inline.hpp"
@@ -120,6 +122,14 @@ jint ParallelScavengeHeap::initialize() {
     return JNI_ENOMEM;
   }
 
+  if (ParallelPeriodicGCInterval > 0) {
+    _periodic_gc_thread = new PSPeriodicGCThread();
+    if (_periodic_gc_thread->osthread() == NULL) {
+      vm_shutdown_during_initialization("Could not create periodic GC thread");
+      return JNI_ENOMEM;
+    }
+  }
+
   return JNI_OK;
 }
 
@@ -162,6 +172,12 @@ void ParallelScavengeHeap::post_initialize() {
   PSPromotionManager::initialize();
 }
 
+void ParallelScavengeHeap::stop() {
+  if (_periodic_gc_thread != NULL) {
+    _periodic_gc_thread->stop();
+  }
+}
+
 void ParallelScavengeHeap::update_counters() {
   young_gen()->update_counters();
   old_gen()->update_counters();
@@ -590,10 +606,17 @@ void ParallelScavengeHeap::print_on_error(outputStream* st) const {
 
 void ParallelScavengeHeap::gc_threads_do(ThreadClosure* tc) const {
   PSScavenge::gc_task_manager()->threads_do(tc);
+  if (_periodic_gc_thread != NULL) {
+    tc->do_thread(_periodic_gc_thread);
+  }
 }
 
 void ParallelScavengeHeap::print_gc_threads_on(outputStream* st) const {
   PSScavenge::gc_task_manager()->print_threads_on(st);
+  if (_periodic_gc_thread != NULL) {
+    _periodic_gc_thread->print_on(st);
+    st->cr();
+  }
 }
 
 void ParallelScavengeHeap::print_tracing_info() const {
@@ -671,6 +694,69 @@ void ParallelScavengeHeap::resize_old_gen(size_t desired_free_space) {
   _old_gen->resize(desired_free_space);
 }
 
+void ParallelScavengeHeap::shrink_after_periodic_gc() {
+  assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
+
+  const size_t young_before = young_gen()->virtual_space()->committed_size();
+  const size_t old_before = old_gen()->virtual_space()->committed_size();
+
+  // Old gen: keep MinHeapFreeRatio percent of the capacity free, as the
+  // other collectors do when they shrink after a full collection.
+  const size_t old_used = old_gen()->used_in_bytes();
+  const double min_free_percentage = (double) MinHeapFreeRatio / 100.0;
+  const double max_used_percentage = 1.0 - min_free_percentage;
+  size_t old_target = (size_t) MIN2((double) old_used / max_used_percentage,
+                                    (double) old_gen()->max_gen_size());
+  old_target = MAX2(old_target, old_gen()->min_gen_size());
+  if (old_target < old_gen()->capacity_in_bytes()) {
+    resize_old_gen(old_target - old_used);
+  }
+
+  // Young gen: shrink to the minimum size. The spaces can only be laid
+  // out again if eden is empty, which is normally the case after a full
+  // collection unless the old gen was too full to take its live objects.
+  PSYoungGen* young = young_gen();
+  if (UseAdaptiveSizePolicy && young->eden_space()->is_empty()) {
+    if (young->from_space()->is_empty()) {
+      young->from_space()->clear(SpaceDecorator::Mangle);
+      young->swap_spaces();
+    }
+    if (young->to_space()->is_empty()) {
+      const size_t alignment = space_alignment();
+      size_t survivor_size = align_down(young->min_gen_size() / InitialSurvivorRatio, alignment);
+      survivor_size = MAX3(survivor_size, alignment,
+                           align_up(young->from_space()->used_in_bytes(), alignment));
+      size_t eden_size = alignment;
+      if (young->min_gen_size() > 2 * survivor_size + alignment) {
+        eden_size = young->min_gen_size() - 2 * survivor_size;
+      }
+      // A single resize can only give back the committed memory above
+      // the end of the survivor spaces, so lay out the spaces for the
+      // target sizes first and resize until the minimum size is reached
+      // or a resize makes no progress.
+      young->layout_spaces(eden_size, survivor_size);
+      size_t committed = young->virtual_space()->committed_size();
+      while (committed > young->min_gen_size()) {
+        resize_young_gen(eden_size, survivor_size);
+        const size_t new_committed = young->virtual_space()->committed_size();
+        if (new_committed >= committed) {
+          break;
+        }
+        committed = new_committed;
+      }
+    }
+  }
+
+  const size_t young_after = young_gen()->virtual_space()->committed_size();
+  const size_t old_after = old_gen()->virtual_space()->committed_size();
+  log_info(gc, heap)("Periodic GC shrink: young " SIZE_FORMAT "K->" SIZE_FORMAT "K, uncommitted " SIZE_FORMAT "K; "
+                     "old " SIZE_FORMAT "K->" SIZE_FORMAT "K, uncommitted " SIZE_FORMAT "K",
+                     young_before / K, young_after / K,
+                     young_before > young_after ? (young_before - young_after) / K : 0,
+                     old_before / K, old_after / K,
+                     old_before > old_after ? (old_before - old_after) / K : 0);
+}
+
 ParallelScavengeHeap::ParStrongRootsScope::ParStrongRootsScope() {
   // nothing particular
 }
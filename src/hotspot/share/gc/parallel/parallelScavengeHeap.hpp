@@ -49,6 +49,7 @@ class MemoryPool;
 class PSAdaptiveSizePolicy;
 class PSCardTable;
 class PSHeapSummary;
+class PSPeriodicGCThread;
 
 class ParallelScavengeHeap : public CollectedHeap {
   friend class VMStructs;
@@ -72,6 +73,9 @@ class ParallelScavengeHeap : public CollectedHeap {
   // The task manager
   static GCTaskManager* _gc_task_manager;
 
+  // Triggers collections of an idle heap, NULL if disabled.
+  PSPeriodicGCThread* _periodic_gc_thread;
+
   GCMemoryManager* _young_manager;
   GCMemoryManager* _old_manager;
 
@@ -93,7 +97,8 @@ class ParallelScavengeHeap : public CollectedHeap {
 
  public:
   ParallelScavengeHeap(GenerationSizer* policy) :
-    CollectedHeap(), _collector_policy(policy), _death_march_count(0) { }
+    CollectedHeap(), _collector_policy(policy), _death_march_count(0),
+    _periodic_gc_thread(NULL) { }
 
   // For use by VM operations
   enum CollectionType {
@@ -140,6 +145,8 @@ class ParallelScavengeHeap : public CollectedHeap {
   void post_initialize();
   void update_counters();
 
+  virtual void stop();
+
   // The alignment used for the various areas
   size_t space_alignment()      { return _collector_policy->space_alignment(); }
   size_t generation_alignment() { return _collector_policy->gen_alignment(); }
@@ -243,6 +250,11 @@ class ParallelScavengeHeap : public CollectedHeap {
   // generation may be expanded in preparation for the resize.
   void resize_old_gen(size_t desired_free_space);
 
+  // Shrink both generations after a periodic collection so that they
+  // keep only MinHeapFreeRatio free space (old gen) or their minimum
+  // size (young gen), and uncommit the rest.
+  void shrink_after_periodic_gc();
+
   // Save the tops of the spaces in all generations
   void record_gen_tops_before_GC() PRODUCT_RETURN;
 
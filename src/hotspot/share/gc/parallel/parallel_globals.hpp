@@ -52,6 +52,20 @@
           "Use maximum compaction in the Parallel Old garbage collector "   \
           "for a system GC")                                                \
                                                                             \
+  product(uintx, ParallelPeriodicGCInterval, 0,                             \
+          "Number of milliseconds without any garbage collection after "    \
+          "which a full collection is triggered to compact the heap and "   \
+          "uncommit unused memory. A value of zero disables periodic "      \
+          "collections.")                                                   \
+          range(0, max_uintx)                                               \
+                                                                            \
+  product(double, ParallelPeriodicGCSystemLoadThreshold, 0.0,               \
+          "Maximum recent system wide load as returned by the 1m value "    \
+          "of getloadavg() at which a periodic collection is started. A "   \
+          "load above this value cancels a given periodic collection. A "   \
+          "value of zero disables this check.")                             \
+          range(0.0, (double)max_uintx)                                     \
+                                                                            \
   product(size_t, ParallelOldDeadWoodLimiterMean, 50,                        \
           "The mean used by the parallel compact dead wood "                \
           "limiter (a number between 0-100)")                               \
@@ -77,6 +91,11 @@
   develop(uintx, GCWorkerDelayMillis, 0,                                    \
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
+  product(intx, PSArrayPrefetchIntervalInBytes, 256,                        \
+          "How far ahead in an object array to prefetch the headers of "    \
+          "the referents during a scavenge (<= 0 means off)")               \
+          range(-1, max_jint)                                               \
+                                                                            \
   product(bool, PSChunkLargeArrays, true,                                   \
           "Process large arrays in chunks")
 
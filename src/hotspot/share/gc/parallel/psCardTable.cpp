@@ -31,11 +31,16 @@
 #include "gc/parallel/psScavenge.inline.hpp"
 #include "gc/parallel/psTasks.hpp"
 #include "gc/parallel/psYoungGen.hpp"
+#include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/align.hpp"
+#include "utilities/copy.hpp"
 
 // Checks an individual oop for missing precise marks. Mark
 // may be either dirty or newgen.
@@ -128,14 +133,67 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
 // when the space is empty, fix the calculation of
 // end_card to allow sp_top == sp->bottom().
 
+// Most cards are clean, even in a large old gen, so skip clean cards a
+// word at a time.
+jbyte* PSCardTable::find_first_unclean_card(jbyte* start, jbyte* end) {
+  STATIC_ASSERT(clean_card == -1);
+  const uintptr_t clean_word = ~(uintptr_t)0;
+  jbyte* p = start;
+  while (p < end && !is_aligned(p, sizeof(uintptr_t))) {
+    if (!card_is_clean(*p)) {
+      return p;
+    }
+    p++;
+  }
+  while (p + sizeof(uintptr_t) <= end && *(uintptr_t*)p == clean_word) {
+    p += sizeof(uintptr_t);
+  }
+  // Find the unclean card in the current word, or check the remaining cards.
+  while (p < end && card_is_clean(*p)) {
+    p++;
+  }
+  return p;
+}
+
+void PSCardTable::prepare_scavenge_contents_parallel(MutableSpace* sp, uint stripe_total) {
+  // Aim for a few unclean cards per stripe. With sparse unclean cards, larger
+  // stripes reduce the number of start array lookups per stripe; dense
+  // unclean cards need small stripes to balance the scanning work.
+  const size_t unclean_cards_per_stripe = 8;
+  size_t ssize = max_stripe_size;
+  if (_last_unclean_cards > 0) {
+    size_t target = _last_scanned_cards * unclean_cards_per_stripe / _last_unclean_cards;
+    ssize = MAX2(min_stripe_size, MIN2(max_stripe_size, (size_t)1 << log2_intptr((uintptr_t)MAX2(target, (size_t)1))));
+  }
+  // Keep several slices, so that every stripe gets a share of the old gen.
+  const size_t min_slices = 4;
+  size_t cards = pointer_delta(sp->top(), sp->bottom(), HeapWordSize) / card_size;
+  while (ssize > min_stripe_size && ssize * stripe_total * min_slices > cards) {
+    ssize /= 2;
+  }
+  _stripe_size = ssize;
+  _scanned_cards = 0;
+  _unclean_cards = 0;
+}
+
+void PSCardTable::report_scavenge_contents_parallel() {
+  _last_scanned_cards = _scanned_cards;
+  _last_unclean_cards = _unclean_cards;
+  log_debug(gc, scavenge)("Old-to-young roots: stripe size: " SIZE_FORMAT " cards, "
+                          "scanned: " SIZE_FORMAT " cards, unclean: " SIZE_FORMAT " cards",
+                          _stripe_size, _last_scanned_cards, _last_unclean_cards);
+}
+
 void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              MutableSpace* sp,
                                              HeapWord* space_top,
                                              PSPromotionManager* pm,
                                              uint stripe_number,
                                              uint stripe_total) {
-  int ssize = 128; // Naked constant!  Work unit = 64k.
-  int dirty_card_count = 0;
+  const size_t ssize = _stripe_size;
+  size_t scanned_cards = 0;
+  size_t unclean_cards = 0;
+  jlong start_counter = os::elapsed_counter();
 
   // It is a waste to get here if empty.
   assert(sp->bottom() < sp->top(), "Should not be called if empty");
@@ -150,7 +208,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
   for (jbyte* slice = start_card; slice < end_card; slice += slice_width) {
     jbyte* worker_start_card = slice + stripe_number * ssize;
     if (worker_start_card >= end_card)
-      return; // We're done.
+      break; // We're done.
 
     jbyte* worker_end_card = worker_start_card + ssize;
     if (worker_end_card > end_card)
@@ -175,6 +233,25 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     }
 #endif
 
+    scanned_cards += worker_end_card - worker_start_card;
+
+    // Skip stripes without unclean cards before any start array lookups.
+    // The stripe also covers the cards of its last object beyond its end,
+    // so check those, too, unless the object belongs to an earlier stripe.
+    if (find_first_unclean_card(worker_start_card, worker_end_card) == worker_end_card) {
+      if (slice_end == (HeapWord*)sp_top) {
+        continue;
+      }
+      HeapWord* last_object = start_array->object_start(slice_end - 1);
+      if (last_object < slice_start) {
+        continue;
+      }
+      jbyte* last_card = MIN2(byte_for(last_object + oop(last_object)->size()) + 1, end_card);
+      if (find_first_unclean_card(worker_end_card, last_card) == last_card) {
+        continue;
+      }
+    }
+
     // If there are not objects starting within the chunk, skip it.
     if (!start_array->object_starts_in_range(slice_start, slice_end)) {
       continue;
@@ -212,9 +289,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     jbyte* current_card = worker_start_card;
     while (current_card < worker_end_card) {
       // Find an unclean card.
-      while (current_card < worker_end_card && card_is_clean(*current_card)) {
-        current_card++;
-      }
+      current_card = find_first_unclean_card(current_card, worker_end_card);
       jbyte* first_unclean_card = current_card;
 
       // Find the end of a run of contiguous unclean cards
@@ -244,6 +319,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
       jbyte* following_clean_card = current_card;
 
       if (first_unclean_card < worker_end_card) {
+        unclean_cards += following_clean_card - first_unclean_card;
         oop* p = (oop*) start_array->object_start(addr_for(first_unclean_card));
         assert((HeapWord*)p <= addr_for(first_unclean_card), "checking");
         // "p" should always be >= "last_scanned" because newly GC dirtied
@@ -277,8 +353,10 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
         if (following_clean_card >= worker_end_card-1)
           following_clean_card = worker_end_card-1;
 
-        while (first_unclean_card < following_clean_card) {
-          *first_unclean_card++ = clean_card;
+        if (first_unclean_card < following_clean_card) {
+          Copy::fill_to_bytes(first_unclean_card,
+                              following_clean_card - first_unclean_card,
+                              (jubyte)clean_card);
         }
 
         const int interval = PrefetchScanIntervalInBytes;
@@ -317,6 +395,13 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
       current_card++;
     }
   }
+
+  Atomic::add(scanned_cards, &_scanned_cards);
+  Atomic::add(unclean_cards, &_unclean_cards);
+  log_trace(gc, scavenge)("Old-to-young roots stripe %u: %.3fms, scanned: " SIZE_FORMAT " cards, unclean: " SIZE_FORMAT " cards",
+                          stripe_number,
+                          TimeHelper::counter_to_millis(os::elapsed_counter() - start_counter),
+                          scanned_cards, unclean_cards);
 }
 
 // This should be called before a scavenge.
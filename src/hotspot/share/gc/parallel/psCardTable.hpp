@@ -46,18 +46,46 @@ class PSCardTable: public CardTable {
 
   void verify_all_young_refs_precise_helper(MemRegion mr);
 
+  // Bounds of the number of cards per stripe in scavenge_contents_parallel.
+  static const size_t min_stripe_size = 128;   // Work unit = 64k.
+  static const size_t max_stripe_size = 8192;
+
+  // Cards per stripe for the next scavenge_contents_parallel, chosen by
+  // prepare_scavenge_contents_parallel().
+  size_t _stripe_size;
+
+  // Cards examined and unclean cards found by scavenge_contents_parallel
+  // during the current scavenge, and the values of the last scavenge.
+  volatile size_t _scanned_cards;
+  volatile size_t _unclean_cards;
+  size_t _last_scanned_cards;
+  size_t _last_unclean_cards;
+
+  // Returns the first card in [start, end) that is not clean, or end.
+  jbyte* find_first_unclean_card(jbyte* start, jbyte* end);
+
   enum ExtendedCardValue {
     youngergen_card   = CT_MR_BS_last_reserved + 1,
     verify_card       = CT_MR_BS_last_reserved + 5
   };
 
  public:
-  PSCardTable(MemRegion whole_heap) : CardTable(whole_heap, /* scanned_concurrently */ false) {}
+  PSCardTable(MemRegion whole_heap) : CardTable(whole_heap, /* scanned_concurrently */ false),
+    _stripe_size(min_stripe_size),
+    _scanned_cards(0),
+    _unclean_cards(0),
+    _last_scanned_cards(0),
+    _last_unclean_cards(0) {}
 
   static jbyte youngergen_card_val() { return youngergen_card; }
   static jbyte verify_card_val()     { return verify_card; }
 
   // Scavenge support
+  // Chooses the stripe size for the next scavenge_contents_parallel calls,
+  // based on the density of unclean cards in the last scavenge.
+  void prepare_scavenge_contents_parallel(MutableSpace* sp, uint stripe_total);
+  // Logs the card statistics of the scavenge_contents_parallel calls.
+  void report_scavenge_contents_parallel();
   void scavenge_contents_parallel(ObjectStartArray* start_array,
                                   MutableSpace* sp,
                                   HeapWord* space_top,
@@ -1821,8 +1821,11 @@ bool PSParallelCompact::invoke_no_policy(bool maximum_heap_compaction) {
     marking_start.update();
     marking_phase(vmthread_cm, maximum_heap_compaction, &_gc_tracer);
 
-    bool max_on_system_gc = UseMaximumCompactionOnSystemGC
-      && GCCause::is_user_requested_gc(gc_cause);
+    // A periodic collection is only useful if it leaves as much free
+    // space as possible at the end of the old gen, so it may be uncommitted.
+    bool max_on_system_gc = (UseMaximumCompactionOnSystemGC
+      && GCCause::is_user_requested_gc(gc_cause))
+      || gc_cause == GCCause::_parallel_periodic_collection;
     summary_phase(vmthread_cm, maximum_heap_compaction || max_on_system_gc);
 
 #if COMPILER2_OR_JVMCI
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/parallel/psPeriodicGCThread.hpp"
+#include "logging/log.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+
+PSPeriodicGCThread::PSPeriodicGCThread() :
+    ConcurrentGCThread(),
+    _monitor(Mutex::nonleaf,
+             "PSPeriodicGCThread monitor",
+             true,
+             Monitor::_safepoint_check_never),
+    _last_gc_count(0),
+    _last_gc_seen_s(os::elapsedTime()) {
+  set_name("PS Periodic GC");
+  create_and_start();
+}
+
+void PSPeriodicGCThread::sleep_before_next_cycle() {
+  MutexLockerEx x(&_monitor, Mutex::_no_safepoint_check_flag);
+  if (!should_terminate()) {
+    // Poll often enough to notice collections in between, so that the
+    // idle time is measured from the last one with reasonable accuracy.
+    uintx waitms = MIN2(ParallelPeriodicGCInterval, (uintx)1000);
+    _monitor.wait(Mutex::_no_safepoint_check_flag, waitms);
+  }
+}
+
+bool PSPeriodicGCThread::should_start_periodic_gc() {
+  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
+
+  // Any collection since the last check, including our own, restarts
+  // the idle interval. In particular, a VM that stays idle after a
+  // periodic collection is not collected again.
+  uint gc_count = heap->total_collections();
+  if (gc_count != _last_gc_count) {
+    _last_gc_count = gc_count;
+    _last_gc_seen_s = os::elapsedTime();
+    return false;
+  }
+
+  uintx idle_ms = (uintx)((os::elapsedTime() - _last_gc_seen_s) * MILLIUNITS);
+  if (idle_ms < ParallelPeriodicGCInterval) {
+    return false;
+  }
+
+  // Check if load is lower than max.
+  double recent_load;
+  if ((ParallelPeriodicGCSystemLoadThreshold > 0.0f) &&
+      (os::loadavg(&recent_load, 1) == -1 || recent_load > ParallelPeriodicGCSystemLoadThreshold)) {
+    log_debug(gc, periodic)("Load %1.2f is higher than threshold %1.2f. Skipping.",
+                            recent_load, ParallelPeriodicGCSystemLoadThreshold);
+    return false;
+  }
+
+  log_debug(gc, periodic)("No GC for " UINTX_FORMAT "ms, threshold " UINTX_FORMAT "ms.",
+                          idle_ms, ParallelPeriodicGCInterval);
+  return true;
+}
+
+void PSPeriodicGCThread::run_service() {
+  log_info(gc)("Periodic GC enabled with interval " UINTX_FORMAT "ms", ParallelPeriodicGCInterval);
+
+  while (!should_terminate()) {
+    if (should_start_periodic_gc()) {
+      Universe::heap()->collect(GCCause::_parallel_periodic_collection);
+    }
+
+    sleep_before_next_cycle();
+  }
+}
+
+void PSPeriodicGCThread::stop_service() {
+  MutexLockerEx x(&_monitor, Mutex::_no_safepoint_check_flag);
+  _monitor.notify();
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_PARALLEL_PSPERIODICGCTHREAD_HPP
+#define SHARE_VM_GC_PARALLEL_PSPERIODICGCTHREAD_HPP
+
+#include "gc/shared/concurrentGCThread.hpp"
+#include "runtime/mutex.hpp"
+
+// The PSPeriodicGCThread triggers a full collection once the heap has
+// not been collected for ParallelPeriodicGCInterval milliseconds. The
+// collection compacts the heap, after which the generations are shrunk
+// and the freed memory uncommitted, so that an idle VM gives back the
+// memory it needed at its peak.
+class PSPeriodicGCThread: public ConcurrentGCThread {
+private:
+  Monitor _monitor;
+
+  // Collection count and time at which the last collection was observed.
+  uint   _last_gc_count;
+  double _last_gc_seen_s;
+
+  void run_service();
+  void stop_service();
+
+  void sleep_before_next_cycle();
+
+  bool should_start_periodic_gc();
+
+public:
+  PSPeriodicGCThread();
+};
+
+#endif // SHARE_VM_GC_PARALLEL_PSPERIODICGCTHREAD_HPP
@@ -117,6 +117,7 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
   bool promotion_failure_occurred = false;
 
   TASKQUEUE_STATS_ONLY(print_taskqueue_stats());
+  stack_array_depth()->log_numa_steal_stats("Scavenge");
   for (uint i = 0; i < ParallelGCThreads + 1; i++) {
     PSPromotionManager* manager = manager_array(i);
     assert(manager->claimed_stack_depth()->is_empty(), "should be empty");
@@ -348,14 +349,7 @@ template <class T> void PSPromotionManager::process_array_chunk_work(
                                                  int start, int end) {
   assert(start <= end, "invariant");
   T* const base      = (T*)objArrayOop(obj)->base();
-  T* p               = base + start;
-  T* const chunk_end = base + end;
-  while (p < chunk_end) {
-    if (PSScavenge::should_scavenge(p)) {
-      claim_or_forward_depth(p);
-    }
-    ++p;
-  }
+  push_array_elements(base + start, base + end);
 }
 
 void PSPromotionManager::process_array_chunk(oop old) {
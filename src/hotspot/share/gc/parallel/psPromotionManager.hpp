@@ -139,6 +139,9 @@ class PSPromotionManager {
 
   template <class T> void  process_array_chunk_work(oop obj,
                                                     int start, int end);
+  // Pushes the elements in [p, end) of an objArray, prefetching the
+  // headers of the referents PSArrayPrefetchIntervalInBytes ahead.
+  template <class T> inline void push_array_elements(T* p, T* const end);
   void process_array_chunk(oop old);
 
   template <class T> void push_depth(T* p);
@@ -36,6 +36,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 
 inline PSPromotionManager* PSPromotionManager::manager_array(uint index) {
   assert(_manager_array != NULL, "access of NULL manager_array");
@@ -137,11 +138,44 @@ inline void InstanceRefKlass::oop_oop_iterate_reverse<narrowOop, PSPushContentsC
   InstanceKlass::oop_oop_iterate_reverse<narrowOop>(obj, closure);
 }
 
+template <class T>
+inline void PSPromotionManager::push_array_elements(T* p, T* const end) {
+  // Prefetch a few cache lines of elements ahead, so that the prefetch has
+  // time to complete before the referent is reached.
+  const intx ahead = PSArrayPrefetchIntervalInBytes / (intx)sizeof(T);
+  for (; p < end; ++p) {
+    if (ahead > 0 && p + ahead < end) {
+      // The referent's mark is read and updated when its reference is pushed
+      // and popped; fetch it while the elements in between are processed.
+      oop const o = RawAccess<>::oop_load(p + ahead);
+      if (PSScavenge::is_obj_in_young(o)) {
+        Prefetch::write(o->mark_addr_raw(), 0);
+      }
+    }
+    if (PSScavenge::should_scavenge(p)) {
+      claim_or_forward_depth(p);
+    }
+  }
+}
+
 inline void PSPromotionManager::push_contents(oop obj) {
-  if (!obj->klass()->is_typeArray_klass()) {
-    PSPushContentsClosure pcc(this);
-    obj->oop_iterate_backwards(&pcc);
+  Klass* const k = obj->klass();
+  if (k->is_typeArray_klass()) {
+    return;
+  }
+  if (k->is_objArray_klass()) {
+    objArrayOop const a = objArrayOop(obj);
+    if (UseCompressedOops) {
+      narrowOop* const base = (narrowOop*)a->base_raw();
+      push_array_elements(base, base + a->length());
+    } else {
+      oop* const base = (oop*)a->base_raw();
+      push_array_elements(base, base + a->length());
+    }
+    return;
   }
+  PSPushContentsClosure pcc(this);
+  obj->oop_iterate_backwards(&pcc);
 }
 //
 // This method is pretty bulky. It would be nice to split it up
@@ -250,6 +284,9 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
 
     assert(new_obj != NULL, "allocation should have succeeded");
 
+    // Prefetch beyond new_obj
+    Prefetch::write(new_obj, PrefetchCopyIntervalInBytes);
+
     // Copy obj
     Copy::aligned_disjoint_words((HeapWord*)o, (HeapWord*)new_obj, new_obj_size);
 
@@ -267,11 +304,16 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
         assert(young_space()->contains(new_obj), "Attempt to push non-promoted obj");
       }
 
+      // Type arrays have no references to push. They are a large part of
+      // the copied objects in array-heavy heaps, so test for them first.
+      //
       // Do the size comparison first with new_obj_size, which we
       // already have. Hopefully, only a few objects are larger than
       // _min_array_size_for_chunking, and most of them will be arrays.
       // So, the is->objArray() test would be very infrequent.
-      if (new_obj_size > _min_array_size_for_chunking &&
+      if (new_obj->is_typeArray()) {
+        // Nothing to push.
+      } else if (new_obj_size > _min_array_size_for_chunking &&
           new_obj->is_objArray() &&
           PSChunkLargeArrays) {
         // we'll chunk it
@@ -359,10 +359,13 @@ bool PSScavenge::invoke_no_policy() {
 
       GCTaskQueue* q = GCTaskQueue::create();
 
-      if (!old_gen->object_space()->is_empty()) {
+      // Promotion may fill an empty old gen; decide once, before the scavenge.
+      const bool scan_old_to_young_roots = !old_gen->object_space()->is_empty();
+      if (scan_old_to_young_roots) {
         // There are only old-to-young pointers if there are objects
         // in the old gen.
         uint stripe_total = active_workers;
+        card_table()->prepare_scavenge_contents_parallel(old_gen->object_space(), stripe_total);
         for(uint i=0; i < stripe_total; i++) {
           q->enqueue(new OldToYoungRootsTask(old_gen, old_top, i, stripe_total));
         }
@@ -393,6 +396,10 @@ bool PSScavenge::invoke_no_policy() {
         }
 
       gc_task_manager()->execute_and_wait(q);
+
+      if (scan_old_to_young_roots) {
+        card_table()->report_scavenge_contents_parallel();
+      }
     }
 
     scavenge_midpoint.update();
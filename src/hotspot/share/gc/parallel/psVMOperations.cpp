@@ -69,5 +69,8 @@ void VM_ParallelGCSystemGC::doit() {
     heap->invoke_scavenge();
   } else {
     heap->do_full_collection(false);
+    if (_gc_cause == GCCause::_parallel_periodic_collection) {
+      heap->shrink_after_periodic_gc();
+    }
   }
 }
@@ -138,6 +138,12 @@ class PSYoungGen : public CHeapObj<mtGC> {
   //        not allow us to use these values.
   void resize(size_t eden_size, size_t survivor_size);
 
+  // Lay out the spaces for the given sizes without changing the size of
+  // the generation, so that a following resize() can shrink it further.
+  void layout_spaces(size_t eden_size, size_t survivor_size) {
+    resize_spaces(eden_size, survivor_size);
+  }
+
   // Size info
   size_t capacity_in_bytes() const;
   size_t used_in_bytes() const;
@@ -68,6 +68,15 @@ class GCMessage : public FormatBuffer<1024> {
 
 class CollectedHeap;
 
+// Iterates over the objects of a heap from several worker threads at once.
+// Each worker calls object_iterate() with its own worker id; the iterator
+// hands out disjoint parts of the heap until all of it has been visited.
+class ParallelObjectIterator : public CHeapObj<mtGC> {
+ public:
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) = 0;
+  virtual ~ParallelObjectIterator() {}
+};
+
 class GCHeapLog : public EventLogBase<GCMessage> {
  private:
   void log_heap(CollectedHeap* heap, bool before);
@@ -436,6 +445,14 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // over live objects.
   virtual void safe_object_iterate(ObjectClosure* cl) = 0;
 
+  // Returns an iterator that lets thread_num workers of the
+  // get_safepoint_workers() gang iterate over the heap in parallel,
+  // or NULL if the heap does not support parallel iteration.
+  // Only valid at a safepoint; the caller deletes the iterator.
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num) {
+    return NULL;
+  }
+
   // NOTE! There is no requirement that a collector implement these
   // functions.
   //
@@ -108,6 +108,9 @@ const char* GCCause::to_string(GCCause::Cause cause) {
     case _g1_periodic_collection:
       return "G1 Periodic Collection";
 
+    case _parallel_periodic_collection:
+      return "Parallel Periodic Collection";
+
     case _dcmd_gc_run:
       return "Diagnostic Command";
 
@@ -78,6 +78,8 @@ class GCCause : public AllStatic {
     _g1_humongous_allocation,
     _g1_periodic_collection,
 
+    _parallel_periodic_collection,
+
     _dcmd_gc_run,
 
     _shenandoah_stop_vm,
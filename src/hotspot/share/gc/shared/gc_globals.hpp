@@ -463,6 +463,15 @@
   product(int, ActiveProcessorCount, -1,                                    \
           "Specify the CPU count the VM should use and report as active")   \
                                                                             \
+  product(intx, ActiveProcessorCountUpdateInterval, 0,                      \
+          "Interval in milliseconds at which the active processor count "   \
+          "is re-evaluated, e.g. to follow changes of the container CPU "   \
+          "quota. Dynamically sized GC and compiler thread pools are then " \
+          "sized for all processors and use the currently active share. "   \
+          "A value of zero disables the re-evaluation.")                    \
+          range(0, PeriodicTask::max_interval)                              \
+          constraint(ActiveProcessorCountUpdateIntervalFunc, AfterErgo)     \
+                                                                            \
   develop(uintx, MaxVirtMemFraction, 2,                                     \
           "Maximum fraction (1/n) of virtual memory used for ergonomically "\
           "determining maximum heap size")                                  \
@@ -680,7 +689,13 @@
           "Ignore calls to System.gc()")                                    \
                                                                             \
   product(bool, BindGCTaskThreadsToCPUs, false,                             \
-          "Bind GCTaskThreads to CPUs if possible")                         \
+          "Bind parallel GC worker threads to CPUs if possible, taking "    \
+          "CPUs from each NUMA node in turn")                               \
+                                                                            \
+  product(bool, UseNUMAAwareStealing, false,                                \
+          "Let GC workers steal work from workers on the same NUMA node "   \
+          "before trying workers on other nodes. Requires UseNUMA and "     \
+          "BindGCTaskThreadsToCPUs")                                        \
                                                                             \
   product(bool, UseGCTaskAffinity, false,                                   \
           "Use worker affinity when asking for GCTasks")                    \
@@ -779,6 +794,17 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(uintx, TLABIdleGCThreshold, 2,                                    \
+          "Number of consecutive GCs a thread may go without refilling "    \
+          "its TLAB before its TLAB size starts to decay towards the "      \
+          "minimum; 0 disables the decay")                                  \
+          range(0, max_juint)                                               \
+                                                                            \
+  product(bool, TLABFastGrowth, true,                                       \
+          "Double the TLAB size of a thread whenever it has needed "        \
+          "another target number of refills since the last GC, instead "    \
+          "of waiting for the next GC to resize it")                        \
+                                                                            \
   product(uintx, SurvivorRatio, 8,                                          \
           "Ratio of eden/survivor space size")                              \
           range(1, max_uintx-2)                                             \
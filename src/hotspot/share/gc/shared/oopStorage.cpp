@@ -44,6 +44,7 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
 
 OopStorage::AllocationListEntry::AllocationListEntry() : _prev(NULL), _next(NULL) {}
 
@@ -412,7 +413,33 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // is empty, for ease of empty block deletion processing.
 
 oop* OopStorage::allocate() {
-  MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  if (_thread_cache_index != OopStorageThreadCache::no_index) {
+    OopStorageThreadCache* cache = OopStorageThreadCache::current(true /* create */);
+    if (cache != NULL) {
+      return allocate_cached(cache);
+    }
+  }
+
+  lock_allocation_mutex();
+  oop* result = allocate_entry();
+  _allocation_mutex->unlock();
+  if (result != NULL) {
+    Atomic::inc(&_allocation_count); // release updates outside lock.
+  }
+  return result;
+}
+
+// Lock the _allocation_mutex, counting the times it is held by another thread.
+void OopStorage::lock_allocation_mutex() {
+  if (!_allocation_mutex->try_lock()) {
+    Atomic::inc(&_allocation_contention_count);
+    _allocation_mutex->lock_without_safepoint_check();
+  }
+}
+
+// Allocate an entry, without updating _allocation_count.
+oop* OopStorage::allocate_entry() {
+  assert_lock_strong(_allocation_mutex);
 
   // Note: Without this we might never perform cleanup.  As it is,
   // cleanup is only requested here, when completing a concurrent
@@ -432,7 +459,6 @@ oop* OopStorage::allocate() {
   oop* result = block->allocate();
   assert(result != NULL, "allocation failed");
   assert(!block->is_empty(), "postcondition");
-  Atomic::inc(&_allocation_count); // release updates outside lock.
   if (block->is_full()) {
     // Transitioning from not full to full.
     // Remove full blocks from consideration by future allocates.
@@ -608,6 +634,7 @@ void OopStorage::Block::release_entries(uintx releasing, OopStorage* owner) {
     uintx fetched = Atomic::cmpxchg(new_value, &_allocated_bitmask, old_allocated);
     if (fetched == old_allocated) break; // Successful update.
     old_allocated = fetched;             // Retry with updated bitmask.
+    Atomic::inc(&owner->_release_contention_count);
   }
 
   // Now that the bitmask has been updated, if we have a state transition
@@ -699,6 +726,14 @@ inline void check_release_entry(const oop* entry) {
 
 void OopStorage::release(const oop* ptr) {
   check_release_entry(ptr);
+  if (_thread_cache_index != OopStorageThreadCache::no_index) {
+    // Don't create a cache here; release must not allocate memory.
+    OopStorageThreadCache* cache = OopStorageThreadCache::current(false /* create */);
+    if (cache != NULL) {
+      release_cached(cache, ptr);
+      return;
+    }
+  }
   Block* block = find_block_or_null(ptr);
   assert(block != NULL, "%s: invalid release " PTR_FORMAT, name(), p2i(ptr));
   log_trace(oopstorage, ref)("%s: released " PTR_FORMAT, name(), p2i(ptr));
@@ -707,6 +742,12 @@ void OopStorage::release(const oop* ptr) {
 }
 
 void OopStorage::release(const oop* const* ptrs, size_t size) {
+  release_to_blocks(ptrs, size);
+  Atomic::sub(size, &_allocation_count);
+}
+
+// Release the entries to their blocks, without updating _allocation_count.
+void OopStorage::release_to_blocks(const oop* const* ptrs, size_t size) {
   size_t i = 0;
   while (i < size) {
     check_release_entry(ptrs[i]);
@@ -730,10 +771,119 @@ void OopStorage::release(const oop* const* ptrs, size_t size) {
     }
     // Release the contiguous entries that are in block.
     block->release_entries(releasing, this);
-    Atomic::sub(count, &_allocation_count);
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// Thread caches
+
+OopStorage* OopStorageThreadCache::_storages[OopStorageThreadCache::max_storages] = {};
+uint OopStorageThreadCache::_num_storages = 0;
+
+OopStorageThreadCache::OopStorageThreadCache() {
+  for (uint i = 0; i < max_storages; ++i) {
+    _magazines[i]._count = 0;
+  }
+}
+
+OopStorageThreadCache::~OopStorageThreadCache() {
+  for (uint i = 0; i < _num_storages; ++i) {
+    Magazine* m = magazine(i);
+    flush(_storages[i], m->_entries, m->_count);
+    m->_count = 0;
+  }
+}
+
+OopStorageThreadCache* OopStorageThreadCache::current(bool create) {
+  Thread* thread = Thread::current_or_null();
+  if (thread == NULL) {
+    return NULL;
+  }
+  OopStorageThreadCache* cache = thread->oop_storage_cache();
+  if (cache == NULL && create) {
+    cache = new (std::nothrow) OopStorageThreadCache();
+    thread->set_oop_storage_cache(cache);
+  }
+  return cache;
+}
+
+static int compare_entries(oop* e1, oop* e2) {
+  return (e1 < e2) ? -1 : ((e1 > e2) ? 1 : 0);
+}
+
+void OopStorageThreadCache::flush(OopStorage* storage, oop** entries, uint count) {
+  if (count > 0) {
+    // Sorting groups the entries by block, so that each block is updated
+    // only once.
+    QuickSort::sort(entries, count, compare_entries, false);
+    storage->release_to_blocks(entries, count);
+  }
+}
+
+void OopStorage::enable_thread_caches(uint cache_size) {
+  assert(_thread_cache_index == OopStorageThreadCache::no_index,
+         "%s: thread caches already enabled", name());
+  assert(cache_size <= OopStorageThreadCache::max_entries,
+         "%s: invalid thread cache size %u", name(), cache_size);
+  if (cache_size == 0) {
+    return;
+  }
+  uint index = OopStorageThreadCache::_num_storages;
+  if (index == OopStorageThreadCache::max_storages) {
+    log_debug(oopstorage)("%s: no thread caches available", name());
+    return;
+  }
+  OopStorageThreadCache::_storages[index] = this;
+  OopStorageThreadCache::_num_storages = index + 1;
+  _thread_cache_index = index;
+  _thread_cache_size = cache_size;
+}
+
+oop* OopStorage::allocate_cached(OopStorageThreadCache* cache) {
+  OopStorageThreadCache::Magazine* m = cache->magazine(_thread_cache_index);
+  if (m->_count == 0) {
+    // Refill half the cache while locking the _allocation_mutex only once.
+    uint refill = MAX2(1u, _thread_cache_size / 2);
+    lock_allocation_mutex();
+    for ( ; m->_count < refill; ++m->_count) {
+      oop* entry = allocate_entry();
+      if (entry == NULL) break; // Block allocation failed.
+      m->_entries[m->_count] = entry;
+    }
+    _allocation_mutex->unlock();
+    if (m->_count == 0) {
+      return NULL;
+    }
+  }
+  oop* result = m->_entries[--m->_count];
+  assert(*result == NULL, "cached entry not cleared: " PTR_FORMAT, p2i(result));
+  Atomic::inc(&_allocation_count);
+  return result;
+}
+
+void OopStorage::release_cached(OopStorageThreadCache* cache, const oop* ptr) {
+  assert(find_block_or_null(ptr) != NULL, "%s: invalid release " PTR_FORMAT, name(), p2i(ptr));
+  OopStorageThreadCache::Magazine* m = cache->magazine(_thread_cache_index);
+#ifdef ASSERT
+  for (uint i = 0; i < m->_count; ++i) {
+    assert(m->_entries[i] != ptr, "%s: duplicate release " PTR_FORMAT, name(), p2i(ptr));
+  }
+#endif // ASSERT
+  if (m->_count == _thread_cache_size) {
+    // Return the older half of the entries, keeping the most recently
+    // released ones for reuse.
+    uint n = MAX2(1u, _thread_cache_size / 2);
+    OopStorageThreadCache::flush(this, m->_entries, n);
+    for (uint i = n; i < m->_count; ++i) {
+      m->_entries[i - n] = m->_entries[i];
+    }
+    m->_count -= n;
+  }
+  log_trace(oopstorage, ref)("%s: released " PTR_FORMAT " to thread cache", name(), p2i(ptr));
+  m->_entries[m->_count++] = const_cast<oop*>(ptr);
+  Atomic::dec(&_allocation_count);
+}
+
 const char* dup_name(const char* name) {
   char* dup = NEW_C_HEAP_ARRAY(char, strlen(name) + 1, mtGC);
   strcpy(dup, name);
@@ -754,9 +904,13 @@ OopStorage::OopStorage(const char* name,
   _active_array(ActiveArray::create(initial_active_array_size)),
   _allocation_list(),
   _deferred_updates(NULL),
+  _release_contention_count(0),
   _allocation_mutex(allocation_mutex),
   _active_mutex(active_mutex),
   _allocation_count(0),
+  _allocation_contention_count(0),
+  _thread_cache_index(OopStorageThreadCache::no_index),
+  _thread_cache_size(0),
   _concurrent_iteration_count(0),
   _needs_cleanup(needs_cleanup_none)
 {
@@ -898,6 +1052,14 @@ size_t OopStorage::allocation_count() const {
   return _allocation_count;
 }
 
+size_t OopStorage::allocation_contention_count() const {
+  return _allocation_contention_count;
+}
+
+size_t OopStorage::release_contention_count() const {
+  return _release_contention_count;
+}
+
 size_t OopStorage::block_count() const {
   WithActiveArray wab(this);
   // Count access is racy, but don't care.
@@ -1017,6 +1179,8 @@ void OopStorage::print_on(outputStream* st) const {
 
   st->print("%s: " SIZE_FORMAT " entries in " SIZE_FORMAT " blocks (%.F%%), " SIZE_FORMAT " bytes",
             name(), allocations, blocks, alloc_percentage, total_memory_usage());
+  st->print(", contention: allocation " SIZE_FORMAT ", release " SIZE_FORMAT,
+            allocation_contention_count(), release_contention_count());
   if (_concurrent_iteration_count > 0) {
     st->print(", concurrent iteration active");
   }
@@ -32,6 +32,7 @@
 #include "utilities/singleWriterSynchronizer.hpp"
 
 class Mutex;
+class OopStorageThreadCache;
 class outputStream;
 
 // OopStorage supports management of off-heap references to objects allocated
@@ -89,6 +90,20 @@ public:
   // bookkeeping overhead, including this storage object.
   size_t total_memory_usage() const;
 
+  // The number of times allocate() found the _allocation_mutex locked by
+  // another thread, and the number of times release() had to retry the
+  // update of a block's allocation state because of a concurrent update.
+  size_t allocation_contention_count() const;
+  size_t release_contention_count() const;
+
+  // Enables per-thread caches of free entries, see OopStorageThreadCache.
+  // cache_size is the maximum number of entries a thread caches; zero
+  // leaves caching disabled.  Only a few storages can be cached; for any
+  // further storage the request is ignored.  Cached free entries are
+  // still reported as ALLOCATED_ENTRY by allocation_status().
+  // precondition: called during VM initialization, before any allocation.
+  void enable_thread_caches(uint cache_size);
+
   enum EntryStatus {
     INVALID_ENTRY,
     UNALLOCATED_ENTRY,
@@ -100,11 +115,13 @@ public:
   EntryStatus allocation_status(const oop* ptr) const;
 
   // Allocates and returns a new entry.  Returns NULL if memory allocation
-  // failed.  Locks _allocation_mutex.
+  // failed.  Locks _allocation_mutex, unless the entry can be taken from
+  // the current thread's cache.
   // postcondition: *result == NULL.
   oop* allocate();
 
-  // Deallocates ptr.  No locking.
+  // Deallocates ptr.  No locking.  The entry may be kept in the current
+  // thread's cache instead of being returned to its block.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
   void release(const oop* ptr);
@@ -218,6 +235,7 @@ private:
   AllocationList _allocation_list;
 AIX_ONLY(public:)               // xlC 12 on AIX doesn't implement C++ DR45.
   Block* volatile _deferred_updates;
+  volatile size_t _release_contention_count;
 AIX_ONLY(private:)
 
   Mutex* _allocation_mutex;
@@ -225,6 +243,12 @@ AIX_ONLY(private:)
 
   // Volatile for racy unlocked accesses.
   volatile size_t _allocation_count;
+  volatile size_t _allocation_contention_count;
+
+  // Index of this storage's caches in OopStorageThreadCache, or
+  // OopStorageThreadCache::no_index if thread caching is disabled.
+  uint _thread_cache_index;
+  uint _thread_cache_size;
 
   // Protection for _active_array.
   mutable SingleWriterSynchronizer _protect_active;
@@ -236,6 +260,14 @@ AIX_ONLY(private:)
 
   bool try_add_block();
   Block* block_for_allocation();
+  oop* allocate_entry();
+  void lock_allocation_mutex();
+
+  // Thread cache support.
+  oop* allocate_cached(OopStorageThreadCache* cache);
+  void release_cached(OopStorageThreadCache* cache, const oop* ptr);
+  void release_to_blocks(const oop* const* ptrs, size_t size);
+  friend class OopStorageThreadCache;
 
   Block* find_block_or_null(const oop* ptr) const;
   void delete_empty_block(const Block& block);
@@ -275,4 +307,53 @@ AIX_ONLY(private:)
   template<typename F> static SkipNullFn<F> skip_null_fn(F f);
 };
 
+// Per-thread caches of free entries, for storages with many threads
+// allocating and releasing entries at a high rate, such as the JNI global
+// handles.  A thread takes entries from and releases entries to its cache
+// without any synchronization.  Only an empty cache is refilled, with half
+// its capacity, during a single locking of the storage's allocation mutex.
+// A full cache returns half its entries to their blocks with one lock-free
+// bulk release.
+//
+// Cached entries are allocated in their blocks and contain NULL, like an
+// entry that has been allocated but not yet set.  They are not included
+// in the storage's allocation_count.  The cache is deleted with its
+// thread, returning all entries.
+class OopStorageThreadCache : public CHeapObj<mtGC> {
+  friend class OopStorage;
+
+public:
+  static const uint max_storages = 2;
+  static const uint max_entries = 64;
+  static const uint no_index = max_storages;
+
+private:
+  struct Magazine {
+    uint _count;
+    oop* _entries[max_entries];
+  };
+
+  Magazine _magazines[max_storages];
+
+  static OopStorage* _storages[max_storages];
+  static uint _num_storages;
+
+  Magazine* magazine(uint index) {
+    assert(index < _num_storages, "invalid index %u", index);
+    return &_magazines[index];
+  }
+
+  // Returns the given entries to storage, without updating its
+  // allocation_count.  Sorts the entries.
+  static void flush(OopStorage* storage, oop** entries, uint count);
+
+public:
+  OopStorageThreadCache();
+  ~OopStorageThreadCache();
+
+  // Returns the current thread's cache, creating it if needed and create
+  // is true.  Returns NULL if there is no current thread or no cache.
+  static OopStorageThreadCache* current(bool create);
+};
+
 #endif // include guard
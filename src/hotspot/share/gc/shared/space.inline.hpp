@@ -371,7 +371,12 @@ void ContiguousSpace::oop_since_save_marks_iterate(OopClosureType* blk) {
       Prefetch::write(p, interval);
       debug_only(HeapWord* prev = p);
       oop m = oop(p);
-      p += m->oop_iterate_size(blk);
+      if (m->is_typeArray()) {
+        // Type arrays have no references; skip the closure dispatch.
+        p += m->size();
+      } else {
+        p += m->oop_iterate_size(blk);
+      }
     }
   } while (t < top());
 
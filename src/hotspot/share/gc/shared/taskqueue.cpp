@@ -33,6 +33,77 @@
 #include "utilities/debug.hpp"
 #include "utilities/stack.inline.hpp"
 
+void TaskQueueSetSuper::initialize_numa(uint n) {
+  // Without binding the node a worker runs on can change at any time.
+  if (!UseNUMA || !BindGCTaskThreadsToCPUs) {
+    return;
+  }
+  _numa_queues = n;
+  _numa_nodes = NEW_C_HEAP_ARRAY(volatile int, n, mtGC);
+  _numa_steal_counts = NEW_C_HEAP_ARRAY(PaddedEnd<NumaStealCounts>, n, mtGC);
+  for (uint i = 0; i < n; i++) {
+    _numa_nodes[i] = -1;
+    _numa_steal_counts[i]._steals = 0;
+    _numa_steal_counts[i]._remote_steals = 0;
+  }
+}
+
+TaskQueueSetSuper::~TaskQueueSetSuper() {
+  if (_numa_nodes != NULL) {
+    FREE_C_HEAP_ARRAY(volatile int, _numa_nodes);
+    FREE_C_HEAP_ARRAY(PaddedEnd<NumaStealCounts>, _numa_steal_counts);
+  }
+}
+
+int TaskQueueSetSuper::record_numa_node(uint queue_num) {
+  int node = os::numa_get_group_id();
+  // Queues may be used by different gangs over time, so check each time,
+  // but only write when the owner changed.
+  if (_numa_nodes[queue_num] != node) {
+    _numa_nodes[queue_num] = node;
+  }
+  return node;
+}
+
+bool TaskQueueSetSuper::has_numa_peer(uint queue_num, int node) const {
+  for (uint i = 0; i < _numa_queues; i++) {
+    if (i != queue_num && _numa_nodes[i] == node) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void TaskQueueSetSuper::record_numa_steal(uint queue_num, uint victim) {
+  NumaStealCounts* counts = &_numa_steal_counts[queue_num];
+  counts->_steals++;
+  int node = _numa_nodes[queue_num];
+  int victim_node = _numa_nodes[victim];
+  if (node != -1 && victim_node != -1 && node != victim_node) {
+    counts->_remote_steals++;
+  }
+}
+
+void TaskQueueSetSuper::log_numa_steal_stats(const char* name) {
+  if (!has_numa_info()) {
+    return;
+  }
+  size_t steals = 0;
+  size_t remote_steals = 0;
+  for (uint i = 0; i < _numa_queues; i++) {
+    NumaStealCounts* counts = &_numa_steal_counts[i];
+    log_trace(gc, task, stats)("%s: worker %u node %d steals " SIZE_FORMAT " remote " SIZE_FORMAT,
+                               name, i, _numa_nodes[i], counts->_steals, counts->_remote_steals);
+    steals += counts->_steals;
+    remote_steals += counts->_remote_steals;
+    counts->_steals = 0;
+    counts->_remote_steals = 0;
+  }
+  log_debug(gc, task, stats)("%s: steals " SIZE_FORMAT " remote " SIZE_FORMAT " (%.1f%%)",
+                             name, steals, remote_steals,
+                             steals == 0 ? 0.0 : 100.0 * remote_steals / steals);
+}
+
 #ifdef TRACESPINNING
 uint ParallelTaskTerminator::_total_yields = 0;
 uint ParallelTaskTerminator::_total_spins = 0;
@@ -322,7 +322,8 @@ public:
 };
 
 template<class E, MEMFLAGS F, unsigned int N>
-GenericTaskQueue<E, F, N>::GenericTaskQueue() : _last_stolen_queue_id(InvalidQueueId), _seed(17 /* random number */) {
+GenericTaskQueue<E, F, N>::GenericTaskQueue() :
+  _last_stolen_queue_id(InvalidQueueId), _seed(17 /* random number */) {
   assert(sizeof(Age) == sizeof(size_t), "Depends on this.");
 }
 
@@ -367,11 +368,45 @@ private:
 };
 
 class TaskQueueSetSuper {
+  // Steal counts of the owner of one queue, see log_numa_steal_stats().
+  struct NumaStealCounts {
+    size_t _steals;
+    size_t _remote_steals;
+  };
+
+  // NUMA information about the queues of the set, only kept when UseNUMA
+  // is on and the GC workers are bound to processors, so that a worker
+  // stays on one node. The owner of queue i records its node in
+  // _numa_nodes[i] (-1 if not known yet) whenever it starts stealing.
+  uint                       _numa_queues;
+  volatile int*              _numa_nodes;
+  PaddedEnd<NumaStealCounts>* _numa_steal_counts;
+
+protected:
+  TaskQueueSetSuper() : _numa_queues(0), _numa_nodes(NULL), _numa_steal_counts(NULL) {}
+  ~TaskQueueSetSuper();
+
+  void initialize_numa(uint n);
+
+  bool has_numa_info() const { return _numa_nodes != NULL; }
+  // Records and returns the NUMA node of the owner of queue_num, which
+  // must be the calling thread.
+  int record_numa_node(uint queue_num);
+  int numa_node(uint queue_num) const { return _numa_nodes[queue_num]; }
+  // Returns true if another queue's owner is known to be on the given node.
+  bool has_numa_peer(uint queue_num, int node) const;
+  void record_numa_steal(uint queue_num, uint victim);
+
 public:
   // Returns "true" if some TaskQueue in the set contains a task.
   virtual bool peek() = 0;
   // Tasks in queue
   virtual uint tasks() const = 0;
+
+  // Logs the steals since the last call, and how many of them took work
+  // from another NUMA node, with -Xlog:gc+task+stats. Per worker counts
+  // are logged at trace level. Nothing is logged without NUMA information.
+  void log_numa_steal_stats(const char* name);
 };
 
 template <MEMFLAGS F> class TaskQueueSetSuperImpl: public CHeapObj<F>, public TaskQueueSetSuper {
@@ -386,7 +421,7 @@ private:
   uint _n;
   T** _queues;
 
-  bool steal_best_of_2(uint queue_num, E& t);
+  bool steal_best_of_2(uint queue_num, E& t, int local_node);
 
 public:
   GenericTaskQueueSet(uint n);
@@ -397,6 +432,8 @@ public:
   T* queue(uint n);
 
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
+  // With UseNUMAAwareStealing, queues owned by workers on the stealer's NUMA node are tried first
+  // if there are any.
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
 
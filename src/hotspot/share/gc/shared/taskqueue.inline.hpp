@@ -40,6 +40,7 @@ inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n) {
   for (uint i = 0; i < n; i++) {
     _queues[i] = NULL;
   }
+  initialize_numa(n);
 }
 
 template <class T, MEMFLAGS F>
@@ -251,8 +252,11 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+// If local_node is not -1, only queues whose owner is known to run on that
+// NUMA node are considered; the attempt fails if neither sample is one.
+// local_node is only set if the set has NUMA information.
 template<class T, MEMFLAGS F> bool
-GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
+GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t, int local_node) {
   if (_n > 2) {
     T* const local_queue = _queues[queue_num];
     uint k1 = queue_num;
@@ -273,6 +277,14 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
     // Sample both and try the larger.
     uint sz1 = _queues[k1]->size();
     uint sz2 = _queues[k2]->size();
+    if (local_node != -1) {
+      if (numa_node(k1) != local_node) {
+        sz1 = 0;
+      }
+      if (numa_node(k2) != local_node) {
+        sz2 = 0;
+      }
+    }
 
     uint sel_k = 0;
     bool suc = false;
@@ -287,6 +299,9 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
     if (suc) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      if (has_numa_info()) {
+        record_numa_steal(queue_num, sel_k);
+      }
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -295,7 +310,11 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   } else if (_n == 2) {
     // Just try the other one.
     uint k = (queue_num + 1) % 2;
-    return _queues[k]->pop_global(t);
+    bool suc = _queues[k]->pop_global(t);
+    if (suc && has_numa_info()) {
+      record_numa_steal(queue_num, k);
+    }
+    return suc;
   } else {
     assert(_n == 1, "can't be zero.");
     return false;
@@ -304,9 +323,27 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
+  int local_node = -1;
+  if (has_numa_info()) {
+    int node = record_numa_node(queue_num);
+    // Only look for work nearby if some other worker is known to be there.
+    if (UseNUMAAwareStealing && _n > 2 && has_numa_peer(queue_num, node)) {
+      local_node = node;
+    }
+  }
+  if (local_node != -1) {
+    for (uint i = 0; i < _n; i++) {
+      TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
+      if (steal_best_of_2(queue_num, t, local_node)) {
+        TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal());
+        return true;
+      }
+    }
+    // Nothing to steal nearby; escalate to all queues.
+  }
   for (uint i = 0; i < 2 * _n; i++) {
     TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
-    if (steal_best_of_2(queue_num, t)) {
+    if (steal_best_of_2(queue_num, t, -1)) {
       TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal());
       return true;
     }
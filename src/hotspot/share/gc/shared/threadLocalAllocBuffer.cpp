@@ -78,10 +78,23 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
                                    _gc_waste,
                                    _fast_refill_waste,
                                    _slow_refill_waste);
+    stats->update_growths(_growths);
+    _idle_gcs = 0;
   } else {
     assert(_number_of_refills == 0 && _fast_refill_waste == 0 &&
            _slow_refill_waste == 0 && _gc_waste          == 0,
            "tlab stats == 0");
+    if (_idle_gcs < TLABIdleGCThreshold) {
+      _idle_gcs++;
+    }
+    if (TLABIdleGCThreshold > 0 && _idle_gcs >= TLABIdleGCThreshold) {
+      // The thread has not needed a TLAB for a while. Decay its fraction
+      // of eden so that the next resize() shrinks the TLAB it gets when
+      // it wakes up, instead of handing it a TLAB sized for its last
+      // burst of allocation.
+      _allocation_fraction.sample(0.0);
+      stats->update_idle_thread();
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -144,6 +157,7 @@ void ThreadLocalAllocBuffer::resize() {
 }
 
 void ThreadLocalAllocBuffer::reset_statistics() {
+  _growths           = 0;
   _number_of_refills = 0;
   _fast_refill_waste = 0;
   _slow_refill_waste = 0;
@@ -162,6 +176,20 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
 
   initialize(start, top, start + new_size - alignment_reserve());
 
+  // A thread that has needed another target_refills() refills since the
+  // last gc allocates faster than its fraction of eden suggested; let its
+  // next TLAB be larger rather than wait for the next resize().
+  if (ResizeTLAB && TLABFastGrowth && desired_size() < max_size() &&
+      _number_of_refills % target_refills() == 0) {
+    size_t new_desired_size = MIN2(align_object_size(desired_size() * 2), max_size());
+    log_trace(gc, tlab)("TLAB grow: thread: " INTPTR_FORMAT " [id: %2d]"
+                        " refills %d desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                        p2i(thread()), thread()->osthread()->thread_id(),
+                        _number_of_refills, desired_size(), new_desired_size);
+    set_desired_size(new_desired_size);
+    _growths++;
+  }
+
   // Reset amount of internal fragmentation
   set_refill_waste_limit(initial_refill_waste_limit());
 }
@@ -267,7 +295,7 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             " desired_size: " SIZE_FORMAT "KB"
             " slow allocs: %d  refill waste: " SIZE_FORMAT "B"
             " alloc:%8.5f %8.0fKB refills: %d waste %4.1f%% gc: %dB"
-            " slow: %dB fast: %dB",
+            " slow: %dB fast: %dB grown: %u idle gcs: %u",
             tag, p2i(thrd), thrd->osthread()->thread_id(),
             _desired_size / (K / HeapWordSize),
             _slow_allocations, _refill_waste_limit * HeapWordSize,
@@ -276,7 +304,8 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _number_of_refills, waste_percent,
             _gc_waste * HeapWordSize,
             _slow_refill_waste * HeapWordSize,
-            _fast_refill_waste * HeapWordSize);
+            _fast_refill_waste * HeapWordSize,
+            _growths, _idle_gcs);
 }
 
 void ThreadLocalAllocBuffer::set_sample_end() {
@@ -357,7 +386,9 @@ ThreadLocalAllocStats::ThreadLocalAllocStats() :
     _total_slow_refill_waste(0),
     _max_slow_refill_waste(0),
     _total_slow_allocations(0),
-    _max_slow_allocations(0) {}
+    _max_slow_allocations(0),
+    _idle_threads(0),
+    _growths(0) {}
 
 unsigned int ThreadLocalAllocStats::allocating_threads_avg() {
   return MAX2((unsigned int)(_allocating_threads_avg.average() + 0.5), 1U);
@@ -398,6 +429,8 @@ void ThreadLocalAllocStats::update(const ThreadLocalAllocStats& other) {
   _max_slow_refill_waste    = MAX2(_max_slow_refill_waste, other._max_slow_refill_waste);
   _total_slow_allocations  += other._total_slow_allocations;
   _max_slow_allocations     = MAX2(_max_slow_allocations, other._max_slow_allocations);
+  _idle_threads            += other._idle_threads;
+  _growths                 += other._growths;
 }
 
 void ThreadLocalAllocStats::reset() {
@@ -413,6 +446,8 @@ void ThreadLocalAllocStats::reset() {
   _max_slow_refill_waste   = 0;
   _total_slow_allocations  = 0;
   _max_slow_allocations    = 0;
+  _idle_threads            = 0;
+  _growths                 = 0;
 }
 
 void ThreadLocalAllocStats::publish() {
@@ -434,6 +469,8 @@ void ThreadLocalAllocStats::publish() {
                       _total_gc_waste * HeapWordSize, _max_gc_waste * HeapWordSize,
                       _total_slow_refill_waste * HeapWordSize, _max_slow_refill_waste * HeapWordSize,
                       _total_fast_refill_waste * HeapWordSize, _max_fast_refill_waste * HeapWordSize);
+  log_debug(gc, tlab)("TLAB sizing: efficiency: %4.1f%% idle thrds: %d grown: %d",
+                      100.0 - waste_percent, _idle_threads, _growths);
 
   if (UsePerfData) {
     _perf_allocating_threads      ->set_value(_allocating_threads);
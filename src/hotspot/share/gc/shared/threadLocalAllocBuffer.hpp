@@ -67,6 +67,8 @@ private:
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
   size_t    _allocated_size;
+  unsigned  _growths;                            // size doublings since the last gc
+  unsigned  _idle_gcs;                           // consecutive gcs without a refill
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
@@ -111,7 +113,7 @@ private:
   int slow_allocations() const  { return _slow_allocations; }
 
 public:
-  ThreadLocalAllocBuffer() : _allocated_before_last_gc(0), _allocation_fraction(TLABAllocationWeight) {
+  ThreadLocalAllocBuffer() : _allocated_before_last_gc(0), _idle_gcs(0), _allocation_fraction(TLABAllocationWeight) {
     // do nothing.  tlabs must be inited by initialize() calls
   }
 
@@ -219,6 +221,8 @@ private:
   size_t       _max_slow_refill_waste;
   unsigned int _total_slow_allocations;
   unsigned int _max_slow_allocations;
+  unsigned int _idle_threads;
+  unsigned int _growths;
 
 public:
   static void initialize();
@@ -232,6 +236,8 @@ public:
                                size_t fast_refill_waste,
                                size_t slow_refill_waste);
   void update_slow_allocations(unsigned int allocations);
+  void update_idle_thread()                    { _idle_threads += 1; }
+  void update_growths(unsigned int growths)    { _growths += growths; }
   void update(const ThreadLocalAllocStats& other);
 
   void reset();
@@ -46,7 +46,11 @@ uint WorkerPolicy::nof_parallel_worker_threads(uint num,
     // processor after the first 8.  For example, on a 72 cpu machine
     // and a chosen fraction of 5/8
     // use 8 + (72 - 8) * (5/8) == 48 worker threads.
-    uint ncpus = (uint) os::initial_active_processor_count();
+    // Dynamically started workers are provisioned for all processors the
+    // VM may be given later on, see calc_default_active_workers().
+    uint ncpus = UseDynamicNumberOfGCThreads ?
+                 (uint) os::max_active_processor_count() :
+                 (uint) os::initial_active_processor_count();
     threads = (ncpus <= switch_pt) ?
               ncpus :
               (switch_pt + ((ncpus - switch_pt) * num) / den);
@@ -128,6 +132,11 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  // Only use the share of the workers that matches the currently active
+  // processors, e.g. after the container CPU quota has been changed.
+  uintx active_workers_by_cpus = os::scale_to_active_processors((uint) total_workers);
+  new_active_workers = MAX2(min_workers, MIN2(new_active_workers, active_workers_by_cpus));
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
@@ -156,9 +165,10 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   log_trace(gc, task)("WorkerPolicy::calc_default_active_workers() : "
     "active_workers(): " UINTX_FORMAT "  new_active_workers: " UINTX_FORMAT "  "
     "prev_active_workers: " UINTX_FORMAT "\n"
-    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT,
+    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT
+    "  active_workers_by_cpus: " UINTX_FORMAT,
     active_workers, new_active_workers, prev_active_workers,
-    active_workers_by_JT, active_workers_by_heap_size);
+    active_workers_by_JT, active_workers_by_heap_size, active_workers_by_cpus);
   assert(new_active_workers > 0, "Always need at least 1");
   return new_active_workers;
 }
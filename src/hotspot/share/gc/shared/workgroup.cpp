@@ -44,6 +44,16 @@ void  AbstractWorkGang::initialize_workers() {
     vm_exit_out_of_memory(0, OOM_MALLOC_ERROR, "Cannot create GangWorker array.");
   }
 
+  // Distribute the parallel GC workers among the available processors,
+  // unless we were told not to, or if the os doesn't want to.
+  if (BindGCTaskThreadsToCPUs && are_GC_task_threads()) {
+    _processor_assignment = NEW_C_HEAP_ARRAY(uint, total_workers(), mtGC);
+    if (!os::distribute_processes(total_workers(), _processor_assignment)) {
+      FREE_C_HEAP_ARRAY(uint, _processor_assignment);
+      _processor_assignment = NULL;
+    }
+  }
+
   add_workers(true);
 }
 
@@ -301,6 +311,13 @@ void AbstractGangWorker::initialize() {
   assert(_gang != NULL, "No gang to run in");
   os::set_priority(this, NearMaxPriority);
   log_develop_trace(gc, workgang)("Running gang worker for gang %s id %u", gang()->name(), id());
+  uint processor_id;
+  if (gang()->processor_for_worker(id(), &processor_id)) {
+    log_trace(gc, task, thread)("%s: binding to processor %u", name(), processor_id);
+    if (!os::bind_to_processor(processor_id)) {
+      log_debug(gc, task, thread)("Couldn't bind %s to processor %u", name(), processor_id);
+    }
+  }
   // The VM thread should not execute here because MutexLocker's are used
   // as (opposed to MutexLockerEx's).
   assert(!Thread::current()->is_VM_thread(), "VM thread should not be part"
@@ -116,6 +116,9 @@ class AbstractWorkGang : public CHeapObj<mtInternal> {
   uint _created_workers;
   // Printing support.
   const char* _name;
+  // The processor each worker binds itself to, or NULL if the
+  // workers are not bound.
+  uint* _processor_assignment;
 
   ~AbstractWorkGang() {}
 
@@ -135,6 +138,7 @@ class AbstractWorkGang : public CHeapObj<mtInternal> {
       _active_workers(UseDynamicNumberOfGCThreads ? 1U : workers),
       _created_workers(0),
       _name(name),
+      _processor_assignment(NULL),
       _are_GC_task_threads(are_GC_task_threads),
       _are_ConcurrentGC_threads(are_ConcurrentGC_threads)
   { }
@@ -147,6 +151,16 @@ class AbstractWorkGang : public CHeapObj<mtInternal> {
 
   uint total_workers() const { return _total_workers; }
 
+  // Returns whether the given worker should bind itself to a processor,
+  // and if so which.
+  bool processor_for_worker(uint worker_id, uint* processor_id) const {
+    if (_processor_assignment == NULL) {
+      return false;
+    }
+    *processor_id = _processor_assignment[worker_id];
+    return true;
+  }
+
   uint created_workers() const {
     return _created_workers;
   }
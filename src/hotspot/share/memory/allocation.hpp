@@ -130,6 +130,7 @@ class AllocatedObj {
   f(mtArguments,     "Arguments")                                                   \
   f(mtModule,        "Module")                                                      \
   f(mtSafepoint,     "Safepoint")                                                   \
+  f(mtNativeArena,   "Native Arena") /* chunks of jdk.internal.misc.NativeArena   */ \
   f(mtNone,          "Unknown")                                                     \
   //end
 
@@ -28,10 +28,13 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
+#include "logging/log.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/reflectionAccessorImplKlassHelper.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -237,6 +240,40 @@ size_t KlassInfoTable::size_of_instances_in_words() const {
   return _size_of_instances_in_words;
 }
 
+// Return false if the entry could not be recorded on account
+// of running out of space required to create a new entry.
+bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
+  Klass*          k = cie->klass();
+  KlassInfoEntry* elt = lookup(k);
+  if (elt != NULL) {
+    elt->set_count(elt->count() + cie->count());
+    elt->set_words(elt->words() + cie->words());
+    _size_of_instances_in_words += cie->words();
+    return true;
+  }
+  return false;
+}
+
+class KlassInfoTableMergeClosure : public KlassInfoClosure {
+ private:
+  KlassInfoTable* _dest;
+  size_t _missed_count;
+ public:
+  KlassInfoTableMergeClosure(KlassInfoTable* table) : _dest(table), _missed_count(0) {}
+  void do_cinfo(KlassInfoEntry* cie) {
+    if (!_dest->merge_entry(cie)) {
+      _missed_count += cie->count();
+    }
+  }
+  size_t missed_count() { return _missed_count; }
+};
+
+size_t KlassInfoTable::merge(KlassInfoTable* table) {
+  KlassInfoTableMergeClosure closure(this);
+  table->iterate(&closure);
+  return closure.missed_count();
+}
+
 int KlassInfoHisto::sort_helper(KlassInfoEntry** e1, KlassInfoEntry** e2) {
   return (*e1)->compare(*e1,*e2);
 }
@@ -710,15 +747,88 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
-size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter) {
+// Each worker fills a private KlassInfoTable from the part of the heap
+// it claims, then merges it into the shared table under _mutex.
+class ParHeapInspectTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  KlassInfoTable* _shared_cit;
+  BoolObjectClosure* _filter;
+  size_t _missed_count;
+  Mutex _mutex;
+
+ public:
+  ParHeapInspectTask(ParallelObjectIterator* poi,
+                     KlassInfoTable* shared_cit,
+                     BoolObjectClosure* filter) :
+      AbstractGangTask("Iterating heap"),
+      _poi(poi),
+      _shared_cit(shared_cit),
+      _filter(filter),
+      _missed_count(0),
+      _mutex(Mutex::leaf, "Parallel heap inspection data merge lock", false,
+             Mutex::_safepoint_check_never) {}
+
+  size_t missed_count() const { return _missed_count; }
+
+  virtual void work(uint worker_id) {
+    KlassInfoTable cit(false);
+    if (cit.allocation_failed()) {
+      // No private table; record straight into the shared one, holding
+      // the lock for the whole of this worker's part of the heap.
+      MutexLockerEx x(&_mutex, Mutex::_no_safepoint_check_flag);
+      RecordInstanceClosure ric(_shared_cit, _filter);
+      _poi->object_iterate(&ric, worker_id);
+      _missed_count += ric.missed_count();
+      return;
+    }
+    RecordInstanceClosure ric(&cit, _filter);
+    _poi->object_iterate(&ric, worker_id);
+    MutexLockerEx x(&_mutex, Mutex::_no_safepoint_check_flag);
+    _missed_count += ric.missed_count();
+    _missed_count += _shared_cit->merge(&cit);
+  }
+};
+
+uint HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter,
+                                    uint parallel_thread_num, size_t* missed_count) {
   ResourceMark rm;
 
+  if (parallel_thread_num != 1) {
+    CollectedHeap* heap = Universe::heap();
+    WorkGang* gang = heap->get_safepoint_workers();
+    if (gang != NULL) {
+      uint num_workers = parallel_thread_num == 0 ? gang->total_workers()
+                                                  : MIN2(parallel_thread_num, gang->total_workers());
+      ParallelObjectIterator* poi = heap->parallel_object_iterator(num_workers);
+      if (poi != NULL) {
+        ParHeapInspectTask task(poi, cit, filter);
+        // Bringing the gang up to size may have to create workers, and
+        // falls short of the request if thread creation fails. Every
+        // worker keeps claiming until the whole heap has been visited,
+        // so running with fewer workers is still complete.
+        uint prev_active_workers = gang->active_workers();
+        num_workers = gang->update_active_workers(num_workers);
+        gang->run_task(&task, num_workers);
+        gang->update_active_workers(prev_active_workers);
+        delete poi;
+        if (missed_count != NULL) {
+          *missed_count = task.missed_count();
+        }
+        return num_workers;
+      }
+    }
+  }
+
   RecordInstanceClosure ric(cit, filter);
   Universe::heap()->object_iterate(&ric);
-  return ric.missed_count();
+  if (missed_count != NULL) {
+    *missed_count = ric.missed_count();
+  }
+  return 1;
 }
 
-void HeapInspection::heap_inspection(outputStream* st) {
+void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num) {
   ResourceMark rm;
 
   if (_print_help) {
@@ -742,7 +852,12 @@ void HeapInspection::heap_inspection(outputStream* st) {
   KlassInfoTable cit(_print_class_stats);
   if (!cit.allocation_failed()) {
     // populate table with object allocation info
-    size_t missed_count = populate_table(&cit);
+    jlong start = os::javaTimeNanos();
+    size_t missed_count = 0;
+    uint used_threads = populate_table(&cit, NULL, parallel_thread_num, &missed_count);
+    log_info(gc, classhisto)("Heap inspection with %u thread(s) took %.3fms",
+                             used_threads,
+                             (double)(os::javaTimeNanos() - start) / NANOUNITS * MILLIUNITS);
     if (missed_count != 0) {
       st->print_cr("WARNING: Ran out of C-heap; undercounted " SIZE_FORMAT
                    " total instances in data below",
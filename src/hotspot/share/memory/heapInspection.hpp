@@ -256,6 +256,10 @@ class KlassInfoTable: public StackObj {
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
   size_t size_of_instances_in_words() const;
+  // Add the counts of another table to this one. Returns the number of
+  // instances that could not be merged for lack of C-heap.
+  size_t merge(KlassInfoTable* table);
+  bool merge_entry(const KlassInfoEntry* cie);
 
   friend class KlassInfoHisto;
   friend class KlassHierarchy;
@@ -359,8 +363,13 @@ class HeapInspection : public StackObj {
                  bool print_class_stats, const char *columns) :
       _csv_format(csv_format), _print_help(print_help),
       _print_class_stats(print_class_stats), _columns(columns) {}
-  void heap_inspection(outputStream* st) NOT_SERVICES_RETURN;
-  size_t populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL) NOT_SERVICES_RETURN_(0);
+  // If the heap supports it, parallel_thread_num GC workers walk the heap,
+  // 0 meaning all of them; with 1, or otherwise, the VM thread walks it alone.
+  void heap_inspection(outputStream* st, uint parallel_thread_num = 1) NOT_SERVICES_RETURN;
+  // Returns the number of threads that walked the heap. The number of
+  // instances not counted for lack of C-heap is stored in missed_count.
+  uint populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL,
+                      uint parallel_thread_num = 1, size_t* missed_count = NULL) NOT_SERVICES_RETURN_(0);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
  private:
   void iterate_over_heap(KlassInfoTable* cit, BoolObjectClosure* filter = NULL);
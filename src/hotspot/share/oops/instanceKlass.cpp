@@ -2156,11 +2156,11 @@ inline DependencyContext InstanceKlass::dependencies() {
 }
 
 int InstanceKlass::mark_dependent_nmethods(KlassDepChange& changes) {
-  return dependencies().mark_dependent_nmethods(changes);
+  return dependencies().mark_dependent_nmethods(changes, this);
 }
 
-void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
-  dependencies().add_dependent_nmethod(nm);
+void InstanceKlass::add_dependent_nmethod(nmethod* nm, int dependency_types) {
+  dependencies().add_dependent_nmethod(nm, dependency_types);
 }
 
 void InstanceKlass::remove_dependent_nmethod(nmethod* nm) {
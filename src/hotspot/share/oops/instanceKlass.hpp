@@ -101,12 +101,28 @@ class OopMapBlock {
   uint count() const         { return _count; }
   void set_count(uint count) { _count = count; }
 
+  void increment_count(int diff) { _count += diff; }
+
+  int offset_span() const { return _count * heapOopSize; }
+
+  int end_offset() const {
+    return offset() + offset_span();
+  }
+
+  bool is_contiguous(int another_offset) const {
+    return another_offset == end_offset();
+  }
+
   // sizeof(OopMapBlock) in words.
   static const int size_in_words() {
     return align_up((int)sizeof(OopMapBlock), wordSize) >>
       LogBytesPerWord;
   }
 
+  static int compare_offset(const OopMapBlock* a, const OopMapBlock* b) {
+    return a->offset() - b->offset();
+  }
+
  private:
   int  _offset;
   uint _count;
@@ -208,6 +224,7 @@ class InstanceKlass: public Klass {
   // _misc_flags.
   bool            _is_marked_dependent;  // used for marking during flushing and deoptimization
   bool            _is_being_redefined;   // used for locking redefinition
+  bool            _has_contended_annotations; // this class or a super uses @Contended
 
   // The low two bits of _misc_flags contains the kind field.
   // This can be used to quickly discriminate among the four kinds of
@@ -536,6 +553,10 @@ public:
   bool is_marked_dependent() const         { return _is_marked_dependent; }
   void set_is_marked_dependent(bool value) { _is_marked_dependent = value; }
 
+  // @Contended on the class, a super class, or one of their instance fields
+  bool has_contended_annotations() const         { return _has_contended_annotations; }
+  void set_has_contended_annotations(bool value) { _has_contended_annotations = value; }
+
   // initialization (virtuals from Klass)
   bool should_be_initialized() const;  // means that initialize should be called
   void initialize(TRAPS);
@@ -971,7 +992,7 @@ public:
   // maintenance of deoptimization dependencies
   inline DependencyContext dependencies();
   int  mark_dependent_nmethods(KlassDepChange& changes);
-  void add_dependent_nmethod(nmethod* nm);
+  void add_dependent_nmethod(nmethod* nm, int dependency_types);
   void remove_dependent_nmethod(nmethod* nm);
   void clean_dependency_context();
 
@@ -60,6 +60,7 @@
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/init.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/relocator.hpp"
 #include "runtime/safepointVerifiers.hpp"
@@ -288,8 +289,9 @@ address Method::bcp_from(address bcp) const {
 }
 
 int Method::size(bool is_native) {
-  // If native, then include pointers for native_function and signature_handler
-  int extra_bytes = (is_native) ? 2*sizeof(address*) : 0;
+  // If native, then include pointers for native_function, signature_handler
+  // and trivial_native_function
+  int extra_bytes = (is_native) ? 3*sizeof(address*) : 0;
   int extra_words = align_up(extra_bytes, BytesPerWord) / BytesPerWord;
   return align_metadata_size(header_size() + extra_words);
 }
@@ -764,6 +766,14 @@ void Method::set_native_function(address function, bool post_event_flag) {
     JvmtiExport::post_native_method_bind(this, &function);
   }
   *native_function = function;
+  // Look up the trivial entry point of the new binding once, so that native
+  // wrappers and compiled callers do not each have to search the library.
+  address* trivial_function = trivial_native_function_addr();
+  *trivial_function = NULL;
+  if (TrivialJNINatives && has_native_function()) {
+    methodHandle mh(this);
+    *trivial_function = NativeLookup::lookup_trivial_entry(mh);
+  }
   // This function can be called more than once. We must make sure that we always
   // use the latest registered method -> check if a stub already has been generated.
   // If so, we have to make it not_entrant.
@@ -771,6 +781,17 @@ void Method::set_native_function(address function, bool post_event_flag) {
   if (nm != NULL) {
     nm->make_not_entrant();
   }
+  // Compiled callers may call the previous trivial entry point directly
+  // (see CallGenerator::for_trivial_native). They record an evol_method
+  // dependency on this method, flush them so they pick up the new binding.
+  // At a safepoint this is done by class redefinition itself.
+  if (TrivialJNINatives && current != NULL &&
+      current != SharedRuntime::native_method_throw_unsatisfied_link_error_entry() &&
+      !SafepointSynchronize::is_at_safepoint()) {
+    methodHandle mh(this);
+    MutexLocker mu(Compile_lock);
+    CodeCache::flush_dependents_on_method(mh);
+  }
 }
 
 
@@ -943,6 +964,7 @@ void Method::unlink_method() {
 
   if (is_native()) {
     *native_function_addr() = NULL;
+    *trivial_native_function_addr() = NULL;
     set_signature_handler(NULL);
   }
   NOT_PRODUCT(set_compiled_invocation_count(0);)
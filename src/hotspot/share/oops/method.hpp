@@ -513,6 +513,8 @@ class Method : public Metadata {
   };
   address native_function() const                { return *(native_function_addr()); }
   address critical_native_function();
+  // Resolved once when the native function is bound (see set_native_function)
+  address trivial_native_function() const        { return *(trivial_native_function_addr()); }
 
   // Must specify a real function (not NULL).
   // Use clear_native_function() to unregister.
@@ -995,6 +997,7 @@ class Method : public Metadata {
   // Inlined elements
   address* native_function_addr() const          { assert(is_native(), "must be native"); return (address*) (this+1); }
   address* signature_handler_addr() const        { return native_function_addr() + 1; }
+  address* trivial_native_function_addr() const  { return native_function_addr() + 2; }
 };
 
 
@@ -80,6 +80,8 @@ uint Block::code_alignment() const {
   if (_pre_order == 1) return InteriorEntryAlignment;
   // Check for loop alignment
   if (has_loop_alignment()) return loop_alignment();
+  // Start the cold code on a fresh cache line
+  if (is_cold_code_start()) return CodeEntryAlignment;
 
   return relocInfo::addr_unit(); // no particular alignment
 }
@@ -333,6 +335,9 @@ void Block::dump_head(const PhaseCFG* cfg, outputStream* st) const {
   } else if (has_loop_alignment()) {
     st->print(" top-of-loop");
   }
+  if (is_cold_code_start()) {
+    st->print(" cold-code-start");
+  }
   st->print(" Freq: %g",_freq);
   if( Verbose || WizardMode ) {
     st->print(" IDom: %d/#%d", _idom ? _idom->_pre_order : 0, _dom_depth);
@@ -713,6 +718,52 @@ void PhaseCFG::remove_empty_blocks() {
   } // End of for all blocks
 }
 
+// A block is cold if it is executed rarely compared to the method entry,
+// or if it is on the path to an uncommon trap or other slow path.
+bool PhaseCFG::is_cold(const Block* block) {
+  return block->_freq < BlockLayoutColdFrequency || block->has_uncommon_code();
+}
+
+// Split the code in a hot and a cold part: keep the relative order of the
+// hot blocks and of the cold blocks but move all cold blocks behind the hot
+// ones, so the frequently executed code is dense in the instruction cache
+// and TLB. fixup_flow() adds the branches needed by the new order. The
+// first cold block is aligned on a cache line so no line is shared between
+// the parts. Connector blocks stay at the end.
+void PhaseCFG::move_cold_blocks_to_end() {
+  uint nblocks = number_of_blocks();
+  Block_List hot;
+  Block_List cold;
+  Block_List connectors;
+  for (uint i = 0; i < nblocks; i++) {
+    Block* block = get_block(i);
+    if (block->is_connector()) {
+      connectors.push(block);
+    } else if (i > 1 && is_cold(block)) {
+      // The root and entry blocks stay in front.
+      cold.push(block);
+    } else {
+      hot.push(block);
+    }
+  }
+  if (cold.size() == 0) {
+    return;
+  }
+
+  clear_blocks();
+  for (uint i = 0; i < hot.size(); i++) {
+    add_block(hot[i]);
+  }
+  cold[0]->set_cold_code_start();
+  for (uint i = 0; i < cold.size(); i++) {
+    add_block(cold[i]);
+  }
+  for (uint i = 0; i < connectors.size(); i++) {
+    add_block(connectors[i]);
+  }
+  assert(number_of_blocks() == nblocks, "lost blocks");
+}
+
 Block *PhaseCFG::fixup_trap_based_check(Node *branch, Block *block, int block_pos, Block *bnext) {
   // Trap based checks must fall through to the successor with
   // PROB_ALWAYS.
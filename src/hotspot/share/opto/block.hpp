@@ -272,6 +272,12 @@ public:
   uint loop_alignment() const { return _loop_alignment; }
   bool has_loop_alignment() const { return loop_alignment() > 0; }
 
+  // First block of the cold part of the code, see
+  // PhaseCFG::move_cold_blocks_to_end().
+  bool _cold_code_start;
+  void set_cold_code_start() { _cold_code_start = true; }
+  bool is_cold_code_start() const { return _cold_code_start; }
+
   // Create a new Block with given head Node.
   // Creates the (empty) predecessor arrays.
   Block( Arena *a, Node *headnode )
@@ -290,7 +296,8 @@ public:
       _raise_LCA_visited(0),
       _first_inst_size(999999),
       _connector(false),
-      _loop_alignment(0) {
+      _loop_alignment(0),
+      _cold_code_start(false) {
     _nodes.push(headnode);
   }
 
@@ -598,6 +605,9 @@ class PhaseCFG : public Phase {
 
   // Remove empty basic blocks
   void remove_empty_blocks();
+  // Move rarely executed blocks behind all other blocks
+  bool is_cold(const Block* block);
+  void move_cold_blocks_to_end();
   Block *fixup_trap_based_check(Node *branch, Block *block, int block_pos, Block *bnext);
   void fixup_flow();
 
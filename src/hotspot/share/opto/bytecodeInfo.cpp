@@ -680,7 +680,9 @@ InlineTree *InlineTree::build_inline_tree_root() {
   Compile* C = Compile::current();
 
   // Root of inline tree
-  InlineTree* ilt = new InlineTree(C, NULL, C->method(), NULL, -1, 1.0F, MaxInlineLevel);
+  // Compilations retried because they got too large also inline less deep.
+  int max_inline_level = MAX2((int)MaxInlineLevel >> C->inlining_reduction(), 1);
+  InlineTree* ilt = new InlineTree(C, NULL, C->method(), NULL, -1, 1.0F, max_inline_level);
 
   return ilt;
 }
@@ -345,6 +345,10 @@
   product(bool, DoReserveCopyInSuperWord, true,                             \
           "Create reserve copy of graph in SuperWord.")                     \
                                                                             \
+  diagnostic(bool, PrintSuperWordReport, false,                             \
+          "Print a line per loop considered by superword telling whether "  \
+          "it was vectorized and, if not, why")                             \
+                                                                            \
   notproduct(bool, TraceSuperWord, false,                                   \
           "Trace superword transforms")                                     \
                                                                             \
@@ -466,6 +470,12 @@
           "Maximum number of nodes")                                        \
           range(1000, max_jint / 3)                                         \
                                                                             \
+  product(uintx, ReduceInliningOnNodeLimit, 2,                              \
+          "Number of times a compilation that runs out of nodes is "        \
+          "retried with progressively less inlining before the method "    \
+          "is marked not compilable")                                       \
+          range(0, 2)                                                       \
+                                                                            \
   product(intx, NodeLimitFudgeFactor, 2000,                                 \
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
@@ -586,6 +596,15 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutSplitColdCode, false,                            \
+          "Move rarely executed blocks behind all other blocks, into a "    \
+          "separately aligned cold part of the compiled code")              \
+                                                                            \
+  product(double, BlockLayoutColdFrequency, 0.001,                          \
+          "Blocks executed less often than this, relative to the method "   \
+          "entry, are cold")                                                \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   diagnostic(bool, InlineReflectionGetCallerClass, true,                    \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
@@ -704,6 +723,15 @@
           "max number of live nodes in a method")                           \
           range(0, max_juint / 8)                                           \
                                                                             \
+  product(intx, MethodHandleLateInlineAttempts, 3,                          \
+          "max number of post parse inlining attempts of a method handle "  \
+          "call whose receiver type keeps improving")                       \
+          range(1, 10)                                                      \
+                                                                            \
+  diagnostic(bool, PrintMethodHandleLateInlining, false,                    \
+          "Print method handle and invokedynamic call sites inlined "       \
+          "after parsing")                                                  \
+                                                                            \
   diagnostic(bool, OptimizeExpensiveOps, true,                              \
           "Find best control for expensive operations")                     \
                                                                             \
@@ -758,6 +786,10 @@
           "Loop with fewer iterations are not strip mined")                 \
           range(0, max_juint)                                               \
                                                                             \
+  product(bool, UseLongLoopNests, false,                                    \
+          "Transform loops with a long induction variable into an outer "   \
+          "long loop around an inner int counted loop")                     \
+                                                                            \
   product(bool, UseProfiledLoopPredicate, true,                             \
           "move predicates out of loops based on profiling data")           \
 
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrIntrinsics.hpp"
 #include "opto/c2compiler.hpp"
 #include "opto/compile.hpp"
@@ -45,6 +46,22 @@ const char* C2Compiler::retry_no_escape_analysis() {
 const char* C2Compiler::retry_class_loading_during_parsing() {
   return "retry class loading during parsing";
 }
+const char* C2Compiler::retry_reduced_inlining() {
+  return "retry with reduced inlining";
+}
+
+static void post_compilation_bailout_event(ciEnv* env, ciMethod* target, Compile& C, bool retried) {
+  EventCompilationBailout event;
+  if (event.should_commit()) {
+    event.set_compileId(env->compile_id());
+    event.set_method(target->get_Method());
+    event.set_reason(C.failure_reason_is(C2Compiler::retry_reduced_inlining()) ? C.too_large_reason() : C.failure_reason());
+    event.set_retried(retried);
+    event.set_nodeCount(C.unique());
+    event.set_inliningReduction(C.inlining_reduction());
+    event.commit();
+  }
+}
 bool C2Compiler::init_c2_runtime() {
 
   // Check assumptions used while running ADLC
@@ -103,13 +120,23 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, Dir
   bool subsume_loads = SubsumeLoads;
   bool do_escape_analysis = DoEscapeAnalysis && !env->should_retain_local_variables();
   bool eliminate_boxing = EliminateAutoBox;
+  int inlining_reduction = 0;
 
   while (!env->failing()) {
     // Attempt to compile while subsuming loads into machine instructions.
-    Compile C(env, this, target, entry_bci, subsume_loads, do_escape_analysis, eliminate_boxing, directive);
+    Compile C(env, this, target, entry_bci, subsume_loads, do_escape_analysis, eliminate_boxing,
+              inlining_reduction, directive);
 
     // Check result and retry if appropriate.
     if (C.failure_reason() != NULL) {
+      if (C.failure_reason_is(retry_reduced_inlining())) {
+        // The graph outgrew MaxNodeLimit: inline less rather than give up.
+        assert(inlining_reduction < (int)ReduceInliningOnNodeLimit, "must make progress");
+        post_compilation_bailout_event(env, target, C, true);
+        inlining_reduction++;
+        env->report_failure(C.failure_reason());
+        continue;  // retry
+      }
       if (C.failure_reason_is(retry_class_loading_during_parsing())) {
         env->report_failure(C.failure_reason());
         continue;  // retry
@@ -136,6 +163,7 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, Dir
       // Pass any other failure reason up to the ciEnv.
       // Note that serious, irreversible failures are already logged
       // on the ciEnv via env->record_method_not_compilable().
+      post_compilation_bailout_event(env, target, C, false);
       env->record_failure(C.failure_reason());
     }
     if (StressRecompilation) {
@@ -599,6 +627,7 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_vectorizedMismatch:
   case vmIntrinsics::_ghash_processBlocks:
   case vmIntrinsics::_base64_encodeBlock:
+  case vmIntrinsics::_base64_decodeBlock:
   case vmIntrinsics::_updateCRC32:
   case vmIntrinsics::_updateBytesCRC32:
   case vmIntrinsics::_updateByteBufferCRC32:
@@ -35,6 +35,8 @@
 #include "opto/callnode.hpp"
 #include "opto/castnode.hpp"
 #include "opto/cfgnode.hpp"
+#include "opto/convertnode.hpp"
+#include "opto/mulnode.hpp"
 #include "opto/parse.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/runtime.hpp"
@@ -260,6 +262,90 @@ JVMState* VirtualCallGenerator::generate(JVMState* jvms) {
   return kit.transfer_exceptions_into_jvms();
 }
 
+//--------------------------TrivialNativeCallGenerator------------------------
+// Internal class which calls the trivial entry point of a static native
+// method directly, as a leaf call without the native wrapper.  Only
+// primitive arguments are passed this way; arrays need the unpacking done
+// by the wrapper.
+class TrivialNativeCallGenerator : public CallGenerator {
+ private:
+  address _entry;
+
+ public:
+  TrivialNativeCallGenerator(ciMethod* method, address entry)
+    : CallGenerator(method), _entry(entry)
+  {
+  }
+  virtual JVMState* generate(JVMState* jvms);
+};
+
+JVMState* TrivialNativeCallGenerator::generate(JVMState* jvms) {
+  GraphKit kit(jvms);
+  kit.C->print_inlining_update(this);
+
+  if (kit.C->log() != NULL) {
+    kit.C->log()->elem("trivial_native_call bci='%d'", jvms->bci());
+  }
+
+  // Rebinding the native method deoptimizes this code.
+  kit.C->dependencies()->assert_evol_method(method());
+
+  // The native function returns subword values in the low bits of the
+  // result register only, so ask for a raw int and narrow it below.
+  ciSignature* sig = method()->signature();
+  BasicType rt = sig->return_type()->basic_type();
+  const TypeTuple* domain = TypeTuple::make_domain(NULL, sig);
+  const TypeTuple* range;
+  if (is_subword_type(rt)) {
+    const Type** fields = TypeTuple::fields(1);
+    fields[TypeFunc::Parms] = TypeInt::INT;
+    range = TypeTuple::make(TypeFunc::Parms + 1, fields);
+  } else {
+    range = TypeTuple::make_range(sig);
+  }
+  const TypeFunc* call_type = TypeFunc::make(domain, range);
+
+  Node* args[8] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+  int nargs = method()->arg_size();
+  assert(nargs <= 8, "checked in for_trivial_native");
+  for (int i = 0; i < nargs; i++) {
+    args[i] = kit.argument(i);
+  }
+
+  // The native may read and write any off-heap memory the caller can
+  // reach, so the call kills all memory.
+  Node* call = kit.make_runtime_call(GraphKit::RC_LEAF,
+                                     call_type, _entry,
+                                     method()->name()->as_utf8(),
+                                     TypePtr::BOTTOM,
+                                     args[0], args[1], args[2], args[3],
+                                     args[4], args[5], args[6], args[7]);
+  if (rt != T_VOID) {
+    Node* ret = kit.gvn().transform(new ProjNode(call, TypeFunc::Parms));
+    switch (rt) {
+      case T_BOOLEAN:
+        ret = kit.gvn().transform(new AndINode(ret, kit.intcon(0xFF)));
+        ret = kit.gvn().transform(new Conv2BNode(ret));
+        break;
+      case T_CHAR:
+        ret = kit.gvn().transform(new AndINode(ret, kit.intcon(0xFFFF)));
+        break;
+      case T_BYTE:
+        ret = kit.gvn().transform(new LShiftINode(ret, kit.intcon(24)));
+        ret = kit.gvn().transform(new RShiftINode(ret, kit.intcon(24)));
+        break;
+      case T_SHORT:
+        ret = kit.gvn().transform(new LShiftINode(ret, kit.intcon(16)));
+        ret = kit.gvn().transform(new RShiftINode(ret, kit.intcon(16)));
+        break;
+      default:
+        break;
+    }
+    kit.push_node(rt, ret);
+  }
+  return kit.transfer_exceptions_into_jvms();
+}
+
 CallGenerator* CallGenerator::for_inline(ciMethod* m, float expected_uses) {
   if (InlineTree::check_can_parse(m) != NULL)  return NULL;
   return new ParseGenerator(m, expected_uses);
@@ -286,6 +372,24 @@ CallGenerator* CallGenerator::for_virtual_call(ciMethod* m, int vtable_index) {
   return new VirtualCallGenerator(m, vtable_index);
 }
 
+CallGenerator* CallGenerator::for_trivial_native(ciMethod* m) {
+  assert(m->is_native(), "for_trivial_native mismatch");
+  if (!m->is_static() || m->is_synchronized() || m->arg_size() > 8) {
+    return NULL;
+  }
+  ciSignature* sig = m->signature();
+  for (int i = 0; i < sig->count(); i++) {
+    if (is_reference_type(sig->type_at(i)->basic_type())) {
+      return NULL;
+    }
+  }
+  address entry = m->trivial_native_entry();
+  if (entry == NULL) {
+    return NULL;
+  }
+  return new TrivialNativeCallGenerator(m, entry);
+}
+
 // Allow inlining decisions to be delayed
 class LateInlineCallGenerator : public DirectCallGenerator {
  private:
@@ -465,13 +569,20 @@ class LateInlineMHCallGenerator : public LateInlineCallGenerator {
   ciMethod* _caller;
   int _attempt;
   bool _input_not_const;
+  // Receiver type at the last attempt when the MemberName was constant
+  // but the linkToVirtual/linkToInterface call could not be bound.
+  const TypeOopPtr* _receiver_type;
 
   virtual bool do_late_inline_check(JVMState* jvms);
   virtual bool already_attempted() const { return _attempt > 0; }
+  virtual bool receiver_type_improved(const Type* t) const;
+
+  void print_late_inline(JVMState* jvms, ciMethod* target) const;
 
  public:
   LateInlineMHCallGenerator(ciMethod* caller, ciMethod* callee, bool input_not_const) :
-    LateInlineCallGenerator(callee, NULL), _caller(caller), _attempt(0), _input_not_const(input_not_const) {}
+    LateInlineCallGenerator(callee, NULL), _caller(caller), _attempt(0), _input_not_const(input_not_const),
+    _receiver_type(NULL) {}
 
   virtual bool is_mh_late_inline() const { return true; }
 
@@ -503,13 +614,51 @@ bool LateInlineMHCallGenerator::do_late_inline_check(JVMState* jvms) {
     assert(!cg->is_late_inline(), "we're doing late inlining");
     _inline_cg = cg;
     Compile::current()->dec_number_of_mh_late_inlines();
+    if (PrintMethodHandleLateInlining) {
+      print_late_inline(jvms, cg->method());
+    }
     return true;
   }
 
+  _receiver_type = NULL;
+  if (cg != NULL && cg->is_virtual() && _attempt < MethodHandleLateInlineAttempts) {
+    // The target is known but the call still dispatches on the receiver:
+    // remember its type so that the call is revisited if IGVN sharpens it.
+    _receiver_type = Compile::current()->initial_gvn()->type(call_node()->in(TypeFunc::Parms))->isa_oopptr();
+  }
+
   call_node()->set_generator(this);
   return false;
 }
 
+bool LateInlineMHCallGenerator::receiver_type_improved(const Type* t) const {
+  if (_receiver_type == NULL || _attempt >= MethodHandleLateInlineAttempts) {
+    return false;
+  }
+  const TypeOopPtr* receiver_type = t->isa_oopptr();
+  if (receiver_type == NULL || receiver_type->klass() == NULL || _receiver_type->klass() == NULL) {
+    return false;
+  }
+  if (receiver_type->klass_is_exact()) {
+    return !_receiver_type->klass_is_exact();
+  }
+  return receiver_type->klass() != _receiver_type->klass() &&
+         receiver_type->klass()->is_subtype_of(_receiver_type->klass());
+}
+
+void LateInlineMHCallGenerator::print_late_inline(JVMState* jvms, ciMethod* target) const {
+  Compile* C = Compile::current();
+  ttyLocker ttyl;
+  tty->print("%d   late inline of method handle call at ", C->compile_id());
+  jvms->method()->print_short_name(tty);
+  tty->print(" @ %d: ", jvms->bci());
+  target->print_short_name(tty);
+  if (_attempt > 1) {
+    tty->print(" (attempt %d, after receiver type sharpening)", _attempt);
+  }
+  tty->cr();
+}
+
 CallGenerator* CallGenerator::for_mh_late_inline(ciMethod* caller, ciMethod* callee, bool input_not_const) {
   Compile::current()->inc_number_of_mh_late_inlines();
   CallGenerator* cg = new LateInlineMHCallGenerator(caller, callee, input_not_const);
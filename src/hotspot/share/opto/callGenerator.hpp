@@ -77,6 +77,8 @@ class CallGenerator : public ResourceObj {
 
   // for method handle calls: have we tried inlinining the call already?
   virtual bool      already_attempted() const   { ShouldNotReachHere(); return false; }
+  // for method handle calls: is the receiver type now sharp enough to try again?
+  virtual bool      receiver_type_improved(const Type* t) const { ShouldNotReachHere(); return false; }
 
   // Replace the call with an inline version of the code
   virtual void do_late_inline() { ShouldNotReachHere(); }
@@ -123,6 +125,8 @@ class CallGenerator : public ResourceObj {
   // How to generate vanilla out-of-line call sites:
   static CallGenerator* for_direct_call(ciMethod* m, bool separate_io_projs = false);   // static, special
   static CallGenerator* for_virtual_call(ciMethod* m, int vtable_index);  // virtual, interface
+  // Direct leaf call to the trivial entry point of a native method, or NULL:
+  static CallGenerator* for_trivial_native(ciMethod* m);
 
   static CallGenerator* for_method_handle_call(  JVMState* jvms, ciMethod* caller, ciMethod* callee, bool delayed_forbidden);
   static CallGenerator* for_method_handle_inline(JVMState* jvms, ciMethod* caller, ciMethod* callee, bool& input_not_const);
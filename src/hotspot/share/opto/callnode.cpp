@@ -939,16 +939,22 @@ Node *CallNode::Ideal(PhaseGVN *phase, bool can_reshape) {
     vmIntrinsics::ID iid = callee->intrinsic_id();
     if (iid == vmIntrinsics::_invokeBasic) {
       if (in(TypeFunc::Parms)->Opcode() == Op_ConP) {
-        phase->C->prepend_late_inline(cg);
+        phase->C->prepend_mh_late_inline(cg);
         set_generator(NULL);
       }
     } else {
       assert(callee->has_member_arg(), "wrong type of call?");
       if (in(TypeFunc::Parms + callee->arg_size() - 1)->Opcode() == Op_ConP) {
-        phase->C->prepend_late_inline(cg);
+        phase->C->prepend_mh_late_inline(cg);
         set_generator(NULL);
       }
     }
+  } else if (can_reshape && cg != NULL && cg->is_mh_late_inline() &&
+             cg->receiver_type_improved(phase->type(in(TypeFunc::Parms)))) {
+    // The call could not be devirtualized with the receiver type known at
+    // the previous attempt but type sharpening has improved it since.
+    phase->C->prepend_mh_late_inline(cg);
+    set_generator(NULL);
   }
   return SafePointNode::Ideal(phase, can_reshape);
 }
@@ -347,12 +347,18 @@ macro(FmaVD)
 macro(FmaVF)
 macro(DivVF)
 macro(DivVD)
+macro(MinVI)
+macro(MinReductionVI)
+macro(MaxVI)
+macro(MaxReductionVI)
+macro(AbsVI)
 macro(AbsVF)
 macro(AbsVD)
 macro(NegVF)
 macro(NegVD)
 macro(SqrtVD)
 macro(SqrtVF)
+macro(VectorCastI2F)
 macro(LShiftCntV)
 macro(RShiftCntV)
 macro(LShiftVB)
@@ -506,6 +506,12 @@ void Compile::print_compile_messages() {
     tty->print_cr("** Bailout: Recompile without boxing elimination       **");
     tty->print_cr("*********************************************************");
   }
+  if (_inlining_reduction > 0 && PrintOpto) {
+    // Recompiling with less inlining
+    tty->print_cr("*********************************************************");
+    tty->print_cr("** Bailout: Recompile with reduced inlining (stage %d)  **", _inlining_reduction);
+    tty->print_cr("*********************************************************");
+  }
   if (C->directive()->BreakAtCompileOption) {
     // Open the debugger when compiling this method.
     tty->print("### Breaking when compiling: ");
@@ -631,13 +637,15 @@ debug_only( int Compile::_debug_idx = 100000; )
 
 
 Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr_bci,
-                  bool subsume_loads, bool do_escape_analysis, bool eliminate_boxing, DirectiveSet* directive)
+                  bool subsume_loads, bool do_escape_analysis, bool eliminate_boxing,
+                  int inlining_reduction, DirectiveSet* directive)
                 : Phase(Compiler),
                   _compile_id(ci_env->compile_id()),
                   _save_argument_registers(false),
                   _subsume_loads(subsume_loads),
                   _do_escape_analysis(do_escape_analysis),
                   _eliminate_boxing(eliminate_boxing),
+                  _inlining_reduction(inlining_reduction),
                   _method(target),
                   _entry_bci(osr_bci),
                   _stub_function(NULL),
@@ -659,6 +667,7 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
                   _directive(directive),
                   _log(ci_env->log()),
                   _failure_reason(NULL),
+                  _too_large_reason(NULL),
                   _congraph(NULL),
 #ifndef PRODUCT
                   _printer(IdealGraphPrinter::printer()),
@@ -969,6 +978,7 @@ Compile::Compile( ciEnv* ci_env,
     _subsume_loads(true),
     _do_escape_analysis(false),
     _eliminate_boxing(false),
+    _inlining_reduction(0),
     _method(NULL),
     _entry_bci(InvocationEntryBci),
     _stub_function(stub_function),
@@ -989,6 +999,7 @@ Compile::Compile( ciEnv* ci_env,
     _directive(directive),
     _log(ci_env->log()),
     _failure_reason(NULL),
+    _too_large_reason(NULL),
     _congraph(NULL),
 #ifndef PRODUCT
     _printer(NULL),
@@ -1124,8 +1135,10 @@ void Compile::Init(int aliaslevel) {
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
   set_do_inlining(Inline);
-  set_max_inline_size(MaxInlineSize);
-  set_freq_inline_size(FreqInlineSize);
+  // Each stage of reduction halves the size of ordinary inlining
+  // candidates and quarters the size of hot ones.
+  set_max_inline_size(MaxInlineSize >> _inlining_reduction);
+  set_freq_inline_size(FreqInlineSize >> (2 * _inlining_reduction));
   set_do_scheduling(OptoScheduling);
   set_do_count_invocations(false);
   set_do_method_data_update(false);
@@ -2535,6 +2548,9 @@ void Compile::Code_Gen() {
     } else {
       cfg.set_loop_alignment();
     }
+    if (BlockLayoutSplitColdCode) {
+      cfg.move_cold_blocks_to_end();
+    }
     cfg.fixup_flow();
   }
 
@@ -3895,6 +3911,26 @@ void Compile::record_failure(const char* reason) {
   _root = NULL;  // flush the graph, too
 }
 
+// A huge method with deep inlining can outgrow MaxNodeLimit (or blow up
+// the register allocator). Most of the graph usually comes from inlined
+// callees, so rather than giving up on the method for good retry the
+// compilation with less inlining first.
+void Compile::record_method_too_large(const char* reason) {
+  if ((uint)_inlining_reduction < ReduceInliningOnNodeLimit &&
+      has_method() && env()->num_inlined_bytecodes() > 0) {
+    if (_too_large_reason == NULL) {
+      _too_large_reason = reason;
+    }
+    if (log() != NULL) {
+      log()->elem("too_large reason='%s' stage='%d' nodes='%d'",
+                  reason, _inlining_reduction, unique());
+    }
+    record_failure(C2Compiler::retry_reduced_inlining());
+  } else {
+    record_method_not_compilable(reason);
+  }
+}
+
 Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
   : TraceTime(name, accumulator, CITime, CITimeVerbose),
     _phase_name(name), _dolog(CITimeVerbose)
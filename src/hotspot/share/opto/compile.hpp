@@ -362,6 +362,7 @@ class Compile : public Phase {
   const bool            _subsume_loads;         // Load can be matched as part of a larger op.
   const bool            _do_escape_analysis;    // Do escape analysis.
   const bool            _eliminate_boxing;      // Do boxing elimination.
+  const int             _inlining_reduction;    // Stage of inlining reduction for oversized methods.
   ciMethod*             _method;                // The method being compiled.
   int                   _entry_bci;             // entry bci for osr methods.
   const TypeFunc*       _tf;                    // My kind of signature
@@ -423,6 +424,7 @@ class Compile : public Phase {
   DirectiveSet*         _directive;             // Compiler directive
   CompileLog*           _log;                   // from CompilerThread
   const char*           _failure_reason;        // for record_failure/failing pattern
+  const char*           _too_large_reason;      // why the graph outgrew the node limit
   GrowableArray<CallGenerator*>* _intrinsics;   // List of intrinsics.
   GrowableArray<Node*>* _macro_nodes;           // List of nodes which need to be expanded before matching.
   GrowableArray<Node*>* _predicate_opaqs;       // List of Opaque1 nodes for the loop predicates.
@@ -630,6 +632,8 @@ class Compile : public Phase {
   bool              eliminate_boxing() const    { return _eliminate_boxing; }
   /** Do aggressive boxing elimination. */
   bool              aggressive_unboxing() const { return _eliminate_boxing && AggressiveUnboxing; }
+  /** Inline less, this compilation is a retry of one that grew too large. */
+  int               inlining_reduction() const  { return _inlining_reduction; }
   bool              save_argument_registers() const { return _save_argument_registers; }
 
 
@@ -865,9 +869,13 @@ class Compile : public Phase {
     // Record failure reason.
     record_failure(reason);
   }
+  // The method got too large to compile. Retry with less inlining if
+  // possible, otherwise give up on it.
+  void record_method_too_large(const char* reason);
+  const char* too_large_reason() const { return _too_large_reason; }
   bool check_node_count(uint margin, const char* reason) {
     if (live_nodes() + margin > max_node_limit()) {
-      record_method_not_compilable(reason);
+      record_method_too_large(reason);
       return true;
     } else {
       return false;
@@ -1058,6 +1066,13 @@ class Compile : public Phase {
     _late_inlines.insert_before(0, cg);
   }
 
+  // A method handle call became a candidate for inlining during IGVN:
+  // make sure incremental inlining goes for another round.
+  void              prepend_mh_late_inline(CallGenerator* cg) {
+    prepend_late_inline(cg);
+    set_inlining_progress(true);
+  }
+
   void              add_string_late_inline(CallGenerator* cg) {
     _string_late_inlines.push(cg);
   }
@@ -1174,7 +1189,7 @@ class Compile : public Phase {
   // continuation.
   Compile(ciEnv* ci_env, C2Compiler* compiler, ciMethod* target,
           int entry_bci, bool subsume_loads, bool do_escape_analysis,
-          bool eliminate_boxing, DirectiveSet* directive);
+          bool eliminate_boxing, int inlining_reduction, DirectiveSet* directive);
 
   // Second major entry point.  From the TypeFunc signature, generate code
   // to pass arguments from the Java calling convention to the C calling
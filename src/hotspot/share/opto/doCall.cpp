@@ -308,6 +308,14 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
     C->log_inline_failure(msg);
     return CallGenerator::for_virtual_call(callee, vtable_index);
   } else {
+    // Trivial natives are called directly, bypassing the native wrapper.
+    if (TrivialJNINatives && allow_inline && callee->is_native()) {
+      CallGenerator* cg = CallGenerator::for_trivial_native(callee);
+      if (cg != NULL) {
+        if (PrintInlining) print_inlining(callee, jvms->depth() - 1, jvms->bci(), "trivial native");
+        return cg;
+      }
+    }
     // Class Hierarchy Analysis or Type Profile reveals a unique target,
     // or it is a static or special call.
     return CallGenerator::for_direct_call(callee, should_delay_inlining(callee, jvms));
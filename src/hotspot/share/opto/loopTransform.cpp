@@ -2019,6 +2019,50 @@ void PhaseIdealLoop::do_maximally_unroll( IdealLoopTree *loop, Node_List &old_ne
   }
 }
 
+//------------------------------convert_cmove_to_min_max-----------------------
+// Math.min/max and the "x < 0 ? -x : x" idiom reach the loop body as CMoveI,
+// which superword can neither pack nor reduce.  Rewrite them into the
+// equivalent MinI/MaxI/AbsI nodes so that they can be vectorized.
+void PhaseIdealLoop::convert_cmove_to_min_max(IdealLoopTree *loop) {
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    if (n->Opcode() != Op_CMoveI) continue;
+    Node* bol = n->in(CMoveNode::Condition);
+    if (!bol->is_Bool() || bol->in(1)->Opcode() != Op_CmpI) continue;
+    bool less;
+    switch (bol->as_Bool()->_test._test) {
+    case BoolTest::lt:
+    case BoolTest::le: less = true;  break;
+    case BoolTest::gt:
+    case BoolTest::ge: less = false; break;
+    default:           continue;
+    }
+    Node* cmp = bol->in(1);
+    Node* x = cmp->in(1);
+    Node* y = cmp->in(2);
+    Node* t = n->in(CMoveNode::IfTrue);
+    Node* f = n->in(CMoveNode::IfFalse);
+    Node* nn = NULL;
+    if (t == x && f == y) {
+      nn = less ? (Node*)new MinINode(x, y) : (Node*)new MaxINode(x, y);
+    } else if (t == y && f == x) {
+      nn = less ? (Node*)new MaxINode(x, y) : (Node*)new MinINode(x, y);
+    } else if (_igvn.type(y) == TypeInt::ZERO && Matcher::match_rule_supported(Op_AbsI)) {
+      // (x < 0) ? (0 - x) : x  or  (x > 0) ? x : (0 - x)
+      Node* neg = less ? t : f;
+      Node* pos = less ? f : t;
+      if (pos == x && neg->Opcode() == Op_SubI && neg->in(2) == x &&
+          _igvn.type(neg->in(1)) == TypeInt::ZERO) {
+        nn = new AbsINode(x);
+      }
+    }
+    if (nn == NULL) continue;
+    register_new_node(nn, get_ctrl(n));
+    _igvn.replace_node(n, nn);
+    loop->_body.map(i, nn);
+  }
+}
+
 void PhaseIdealLoop::mark_reductions(IdealLoopTree *loop) {
   if (SuperWordReductions == false) return;
 
@@ -3171,6 +3215,12 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
   // A post-loop will finish any odd iterations (leftover after
   // unrolling), plus any needed for RCE purposes.
 
+  // Turn min/max idioms into nodes superword can vectorize before the
+  // unrolling policy looks for reductions.
+  if (UseSuperWord) {
+    phase->convert_cmove_to_min_max(this);
+  }
+
   bool should_unroll = policy_unroll(phase);
 
   bool should_rce = policy_range_check(phase);
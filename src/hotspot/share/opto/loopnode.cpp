@@ -32,11 +32,14 @@
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
 #include "opto/callnode.hpp"
+#include "opto/castnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
 #include "opto/idealGraphPrinter.hpp"
 #include "opto/loopnode.hpp"
+#include "opto/matcher.hpp"
+#include "opto/movenode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/superword.hpp"
@@ -264,6 +267,29 @@ void PhaseIdealLoop::set_subtree_ctrl( Node *n ) {
   set_early_ctrl( n );
 }
 
+// Insert a loop tree node for the new loop outer_l right above loop.
+IdealLoopTree* PhaseIdealLoop::insert_outer_loop(IdealLoopTree* loop, LoopNode* outer_l, Node* outer_ift) {
+  IdealLoopTree* outer_ilt = new IdealLoopTree(this, outer_l, outer_ift);
+  IdealLoopTree* parent = loop->_parent;
+  IdealLoopTree* sibling = parent->_child;
+  if (sibling == loop) {
+    parent->_child = outer_ilt;
+  } else {
+    while (sibling->_next != loop) {
+      sibling = sibling->_next;
+    }
+    sibling->_next = outer_ilt;
+  }
+  outer_ilt->_next = loop->_next;
+  outer_ilt->_parent = parent;
+  outer_ilt->_child = loop;
+  outer_ilt->_nest = loop->_nest;
+  loop->_parent = outer_ilt;
+  loop->_next = NULL;
+  loop->_nest++;
+  return outer_ilt;
+}
+
 // Create a skeleton strip mined outer loop: a Loop head before the
 // inner strip mined loop, a safepoint and an exit condition guarded
 // by an opaque node after the inner strip mined loop with a backedge
@@ -294,24 +320,7 @@ IdealLoopTree* PhaseIdealLoop::create_outer_strip_mined_loop(BoolNode *test, Nod
   LoopNode *outer_l = new OuterStripMinedLoopNode(C, init_control, outer_ift);
   entry_control = outer_l;
 
-  IdealLoopTree* outer_ilt = new IdealLoopTree(this, outer_l, outer_ift);
-  IdealLoopTree* parent = loop->_parent;
-  IdealLoopTree* sibling = parent->_child;
-  if (sibling == loop) {
-    parent->_child = outer_ilt;
-  } else {
-    while (sibling->_next != loop) {
-      sibling = sibling->_next;
-    }
-    sibling->_next = outer_ilt;
-  }
-  outer_ilt->_next = loop->_next;
-  outer_ilt->_parent = parent;
-  outer_ilt->_child = loop;
-  outer_ilt->_nest = loop->_nest;
-  loop->_parent = outer_ilt;
-  loop->_next = NULL;
-  loop->_nest++;
+  IdealLoopTree* outer_ilt = insert_outer_loop(loop, outer_l, outer_ift);
 
   set_loop(iffalse, outer_ilt);
   register_control(outer_le, outer_ilt, iffalse);
@@ -899,6 +908,253 @@ bool PhaseIdealLoop::is_counted_loop(Node* x, IdealLoopTree*& loop) {
   return true;
 }
 
+//------------------------------is_long_counted_loop---------------------------
+// Turn a loop with a long induction variable
+//
+//   for (long i = init; i < limit; i += stride) { body(i) }
+//
+// into a nest of an outer long loop around an inner int counted loop
+//
+//   for (long i = init; i < limit; ) {
+//     int inner_limit = (int)MIN(limit - i, max_jint - ABS(stride));
+//     int j = 0;
+//     do { body(i + j); j += stride; } while (j < inner_limit);
+//     i += j;
+//   }
+//
+// so range check elimination, unrolling, vectorization and strip mining
+// apply to the inner loop. The inner loop reuses the control flow and body
+// of the original loop; the outer loop gets a copy of the exit test and of
+// the safepoint. Returns true if the nest was created, loop is then the
+// inner loop.
+bool PhaseIdealLoop::is_long_counted_loop(Node* x, IdealLoopTree* loop) {
+  if (!UseLongLoopNests || x->Opcode() != Op_Loop || x->as_Loop()->is_long_loop_nest()) {
+    return false;
+  }
+  if (x->in(LoopNode::Self) == NULL || x->req() != 3 || loop->_irreducible) {
+    return false;
+  }
+  Node* init_control = x->in(LoopNode::EntryControl);
+  Node* back_control = x->in(LoopNode::LoopBackControl);
+  if (init_control == NULL || back_control == NULL ||
+      init_control->is_top() || back_control->is_top()) {
+    return false;
+  }
+
+  Node* safepoint = NULL;
+  if (back_control->Opcode() == Op_SafePoint) {
+    if (LoopStripMiningIter != 0) {
+      // Same restriction as for int counted loops.
+      return false;
+    }
+    safepoint = back_control;
+    back_control = back_control->in(TypeFunc::Control);
+  }
+
+  Node* iftrue = back_control;
+  uint iftrue_op = iftrue->Opcode();
+  if (iftrue_op != Op_IfTrue && iftrue_op != Op_IfFalse) {
+    return false;
+  }
+  Node* iff = iftrue->in(0);
+  if (get_loop(iff) != loop || !iff->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolNode* test = iff->in(1)->as_Bool();
+  Node* cmp = test->in(1);
+  if (cmp->Opcode() != Op_CmpL) {
+    return false;
+  }
+  if (safepoint == NULL && iff->in(0)->Opcode() == Op_SafePoint) {
+    safepoint = iff->in(0);
+  }
+
+  // Orientation of the test with the trip counter first, and as seen on
+  // the loop back branch.
+  BoolTest::mask mask = test->_test._test;
+  Node* incr = cmp->in(1);
+  Node* limit = cmp->in(2);
+  if (!is_member(loop, get_ctrl(incr))) {
+    incr = cmp->in(2);
+    limit = cmp->in(1);
+    mask = BoolTest(mask).commute();
+  }
+  if (is_member(loop, get_ctrl(limit)) || !is_member(loop, get_ctrl(incr))) {
+    return false;
+  }
+  BoolTest::mask bt = (iftrue_op == Op_IfFalse) ? BoolTest(mask).negate() : mask;
+
+  if (incr->Opcode() != Op_AddL) {
+    return false;
+  }
+  Node* phi = incr->in(1);
+  Node* stride = incr->in(2);
+  if (!stride->is_Con()) {
+    phi = incr->in(2);
+    stride = incr->in(1);
+    if (!stride->is_Con()) {
+      return false;
+    }
+  }
+  if (!phi->is_Phi() || phi->in(0) != x || phi->req() != 3 ||
+      phi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+
+  // The stride must comfortably fit in an int and the test must bound the
+  // trip counter in the direction it moves.
+  jlong stride_con = stride->get_long();
+  if (stride_con == 0 || stride_con > max_jint / 4 || stride_con < -(max_jint / 4)) {
+    return false;
+  }
+  if (!(stride_con > 0 && (bt == BoolTest::lt || bt == BoolTest::le)) &&
+      !(stride_con < 0 && (bt == BoolTest::gt || bt == BoolTest::ge))) {
+    return false;
+  }
+  if (!Matcher::match_rule_supported(Op_CmpUL)) {
+    return false;
+  }
+
+  // =================================================
+  // ---- SUCCESS!   Found A Long Trip-Counted Loop!  -----
+  //
+  IfNode* exit_test = iff->as_If();
+  Node* exit_branch = exit_test->proj_out(iftrue_op == Op_IfFalse);
+
+  // Outer loop: head, copy of the exit test on the inner loop exit and
+  // back branch.
+  Node* inner_exit_branch = exit_branch->clone();
+  IfNode* outer_exit_test = new IfNode(inner_exit_branch, test, exit_test->_prob, exit_test->_fcnt);
+  Node* outer_back_branch = iftrue->clone();
+  outer_back_branch->set_req(0, outer_exit_test);
+  Node* outer_back_control = outer_back_branch;
+  if (safepoint != NULL) {
+    // The inner loop may lose its safepoint once it is counted.
+    outer_back_control = safepoint->clone();
+    outer_back_control->set_req(0, outer_back_branch);
+  }
+  LoopNode* outer_head = new LoopNode(init_control, outer_back_control);
+  outer_head->mark_long_loop_nest();
+
+  IdealLoopTree* outer_ilt = insert_outer_loop(loop, outer_head, outer_back_control);
+  for (IdealLoopTree* l = loop->_child; l != NULL; ) {
+    l->_nest++;
+    if (l->_child != NULL) {
+      l = l->_child;
+    } else {
+      while (l != loop && l->_next == NULL) {
+        l = l->_parent;
+      }
+      l = (l == loop) ? NULL : l->_next;
+    }
+  }
+
+  register_control(outer_head, outer_ilt, init_control);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  set_idom(x, outer_head, dom_depth(outer_head));
+  register_control(inner_exit_branch, outer_ilt, exit_test);
+  register_control(outer_exit_test, outer_ilt, inner_exit_branch);
+  _igvn.replace_input_of(exit_branch, 0, outer_exit_test);
+  set_idom(exit_branch, outer_exit_test, dom_depth(outer_exit_test));
+  register_control(outer_back_branch, outer_ilt, outer_exit_test);
+  if (safepoint != NULL) {
+    register_control(outer_back_control, outer_ilt, outer_back_branch);
+  }
+
+  // Trip counter of the outer loop.
+  Node* outer_phi = phi->clone();
+  outer_phi->set_req(0, outer_head);
+  register_new_node(outer_phi, outer_head);
+
+  // Number of iterations left, as an unsigned long: limit - phi does not
+  // overflow as an unsigned quantity when the loop still has to run.
+  Node* zero_l = _igvn.longcon(0);
+  set_ctrl(zero_l, C->root());
+  Node* left_lo = stride_con > 0 ? outer_phi : limit;
+  Node* left_hi = stride_con > 0 ? limit : outer_phi;
+  Node* left_cmp = new CmpLNode(left_hi, left_lo);
+  register_new_node(left_cmp, outer_head);
+  Node* left_bol = new BoolNode(left_cmp, BoolTest::gt);
+  register_new_node(left_bol, outer_head);
+  Node* left_diff = new SubLNode(left_hi, left_lo);
+  register_new_node(left_diff, outer_head);
+  Node* left = CMoveNode::make(NULL, left_bol, zero_l, left_diff, TypeLong::LONG);
+  register_new_node(left, outer_head);
+
+  // Bound it by what an int trip counter can count without overflowing.
+  jlong iters_limit = max_jint - ABS(stride_con);
+  Node* iters_limit_l = _igvn.longcon(iters_limit);
+  set_ctrl(iters_limit_l, C->root());
+  Node* min_cmp = new CmpULNode(left, iters_limit_l);
+  register_new_node(min_cmp, outer_head);
+  Node* min_bol = new BoolNode(min_cmp, BoolTest::lt);
+  register_new_node(min_bol, outer_head);
+  Node* inner_iters = CMoveNode::make(NULL, min_bol, iters_limit_l, left, TypeLong::LONG);
+  register_new_node(inner_iters, outer_head);
+  Node* inner_limit = new ConvL2INode(inner_iters);
+  register_new_node(inner_limit, outer_head);
+  inner_limit = new CastIINode(inner_limit, TypeInt::make(0, (jint)iters_limit, Type::WidenMin));
+  register_new_node(inner_limit, outer_head);
+  Node* zero = _igvn.intcon(0);
+  set_ctrl(zero, C->root());
+  if (stride_con < 0) {
+    inner_limit = new SubINode(zero, inner_limit);
+    register_new_node(inner_limit, outer_head);
+  }
+
+  // Int trip counter of the inner loop, it now controls the loop exit.
+  Node* int_stride = _igvn.intcon((jint)stride_con);
+  set_ctrl(int_stride, C->root());
+  Node* inner_phi = new PhiNode(x, TypeInt::INT);
+  Node* inner_incr = new AddINode(inner_phi, int_stride);
+  inner_phi->init_req(LoopNode::EntryControl, zero);
+  inner_phi->init_req(LoopNode::LoopBackControl, inner_incr);
+  register_new_node(inner_phi, x);
+  register_new_node(inner_incr, x);
+  Node* inner_cmp = new CmpINode(inner_incr, inner_limit);
+  register_new_node(inner_cmp, x);
+  Node* inner_bol = new BoolNode(inner_cmp, mask);
+  register_new_node(inner_bol, x);
+  _igvn.replace_input_of(exit_test, 1, inner_bol);
+
+  // Values carried around the original loop are now carried around both.
+  Node_List phis;
+  for (DUIterator_Fast imax, i = x->fast_outs(imax); i < imax; i++) {
+    Node* u = x->fast_out(i);
+    if (u->is_Phi() && u != phi && u != inner_phi) {
+      phis.push(u);
+    }
+  }
+  while (phis.size() > 0) {
+    Node* u = phis.pop();
+    Node* outer_u = u->clone();
+    outer_u->set_req(0, outer_head);
+    register_new_node(outer_u, outer_head);
+    _igvn.replace_input_of(u, LoopNode::EntryControl, outer_u);
+  }
+
+  // The long trip counter is the outer one plus the inner one.
+  Node* iv = new AddLNode(outer_phi, new ConvI2LNode(inner_phi));
+  register_new_node(iv->in(2), x);
+  register_new_node(iv, x);
+  Node* new_incr = new AddLNode(outer_phi, new ConvI2LNode(inner_incr));
+  register_new_node(new_incr->in(2), x);
+  register_new_node(new_incr, x);
+  _igvn.replace_node(phi, iv);
+  _igvn.replace_node(incr, new_incr);
+
+  // Dominator depths changed under the new outer loop.
+  recompute_dom_depth();
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("LongLoopNest ");
+    loop->dump_head();
+  }
+#endif
+  return true;
+}
+
 //----------------------exact_limit-------------------------------------------
 Node* PhaseIdealLoop::exact_limit( IdealLoopTree *loop ) {
   assert(loop->_head->is_CountedLoop(), "");
@@ -2409,6 +2665,14 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
     if (_head->is_Loop()) _head->as_Loop()->set_inner_loop();
   }
 
+  // A long counted loop becomes an int counted loop nested in a new outer
+  // loop that takes over this loop's place among its siblings.
+  IdealLoopTree* long_nest = NULL;
+  if (_head->is_Loop() && !_head->is_CountedLoop() &&
+      phase->is_long_counted_loop(_head, this)) {
+    long_nest = _parent;
+  }
+
   IdealLoopTree* loop = this;
   if (_head->is_CountedLoop() ||
       phase->is_counted_loop(_head, loop)) {
@@ -2436,6 +2700,7 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   assert(loop->_child != this || (loop->_child->_child == NULL && loop->_child->_next == NULL), "would miss some loops");
   if (loop->_child && loop->_child != this) loop->_child->counted_loop(phase);
   if (loop->_next)  loop->_next ->counted_loop(phase);
+  if (long_nest != NULL && long_nest->_next != NULL) long_nest->_next->counted_loop(phase);
 }
 
 #ifndef PRODUCT
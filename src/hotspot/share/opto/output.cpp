@@ -1155,6 +1155,10 @@ void Compile::fill_buffer(CodeBuffer* cb, uint* blk_starts) {
 #endif
     int blk_offset = current_offset;
 
+    if (block->is_cold_code_start() && log() != NULL) {
+      log()->elem("cold_code offset='%d'", blk_offset);
+    }
+
     // Define the label at the beginning of the basic block
     MacroAssembler(cb).bind(blk_labels[block->_pre_order]);
 
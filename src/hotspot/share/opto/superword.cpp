@@ -77,6 +77,8 @@ SuperWord::SuperWord(PhaseIdealLoop* phase) :
   _do_reserve_copy(DoReserveCopyInSuperWord),
   _num_work_vecs(0),                      // amount of vector work we have
   _num_reductions(0),                     // amount of reduction work we have
+  _report_reason(NULL),                   // why the loop was not vectorized
+  _report_opc(0),                         // unimplemented scalar opcode
   _ii_first(-1),                          // first loop generation index - only if do_vector_loop()
   _ii_last(-1),                           // last loop generation index - only if do_vector_loop()
   _ii_order(arena(), 8, 0, 0)
@@ -166,6 +168,9 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
   if (do_optimization) {
     assert(_packset.length() == 0, "packset must be empty");
     SLP_extract();
+    if (PrintSuperWordReport) {
+      print_report();
+    }
     if (PostLoopMultiversioning && Matcher::has_predicated_vectors()) {
       if (cl->is_vectorized_loop() && cl->is_main_loop() && !cl->is_reduction_loop()) {
         IdealLoopTree *lpt_next = lpt->_next;
@@ -182,6 +187,30 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
   }
 }
 
+//------------------------------print_report---------------------------
+void SuperWord::print_report() {
+  CountedLoopNode* cl = lpt()->_head->as_CountedLoop();
+  Compile* C = _phase->C;
+  ttyLocker ttyl;
+  tty->print("SuperWord: ");
+  if (C->method() != NULL) {
+    C->method()->print_short_name(tty);
+  } else {
+    tty->print("%s", C->stub_name());
+  }
+  tty->print(" loop N%d (%s)", cl->_idx,
+             cl->is_main_loop() ? "main" : (cl->is_post_loop() ? "post" : "normal"));
+  if (cl->is_vectorized_loop()) {
+    tty->print_cr(" vectorized, %d packs", _packset.length());
+  } else if (_report_reason == NULL) {
+    tty->print_cr(" not vectorized: vector code generation bailed out");
+  } else if (_report_opc != 0) {
+    tty->print_cr(" not vectorized: %s (%s)", _report_reason, NodeClassNames[_report_opc]);
+  } else {
+    tty->print_cr(" not vectorized: %s", _report_reason);
+  }
+}
+
 //------------------------------early unrolling analysis------------------------------
 void SuperWord::unrolling_analysis(int &local_loop_unroll_factor) {
   bool is_slp = true;
@@ -454,6 +483,7 @@ void SuperWord::SLP_extract() {
 #endif
   // Ready the block
   if (!construct_bb()) {
+    set_report_reason("no memory operations or complex graph");
     return; // Exit if no interesting nodes or complex graph.
   }
 
@@ -471,6 +501,7 @@ void SuperWord::SLP_extract() {
         hoist_loads_in_graph(); // this only rebuild the graph; all basic structs need rebuild explicitly
 
         if (!construct_bb()) {
+          set_report_reason("no memory operations or complex graph");
           return; // Exit if no interesting nodes or complex graph.
         }
         dependence_graph();
@@ -497,6 +528,9 @@ void SuperWord::SLP_extract() {
     // Attempt vectorization
 
     find_adjacent_refs();
+    if (_packset.length() == 0) {
+      set_report_reason("no adjacent memory references");
+    }
 
     extend_packlist();
 
@@ -1673,6 +1707,9 @@ void SuperWord::filter_packs() {
         pk->at(0)->dump();
       }
 #endif
+      if (_report_opc == 0 && !pk->at(0)->is_Mem()) {
+        _report_opc = pk->at(0)->Opcode();
+      }
       remove_pack_at(i);
     }
     Node *n = pk->at(0);
@@ -1703,6 +1740,10 @@ void SuperWord::filter_packs() {
     }
   } while (changed);
 
+  if (_packset.length() == 0) {
+    set_report_reason(_report_opc != 0 ? "unimplemented vector operation" : "no profitable packs");
+  }
+
 #ifndef PRODUCT
   if (TraceSuperWord) {
     tty->print_cr("\nAfter filter_packs");
@@ -1983,6 +2024,11 @@ bool SuperWord::profitable(Node_List* p) {
       return false;
     }
   }
+  if (p0->Opcode() == Op_ConvI2F && my_pack(p0->in(1)) == NULL) {
+    // Scalar promotion would replicate the int input with the float type
+    // of the conversion, so only accept packed inputs.
+    return false;
+  }
   if (VectorNode::is_shift(p0)) {
     // For now, return false if shift count is vector or not scalar promotion
     // case (different shift counts) because it is not supported yet.
@@ -2414,9 +2460,9 @@ void SuperWord::output() {
           vlen_in_bytes = vn->as_Vector()->length_in_bytes();
         }
       } else if (opc == Op_SqrtF || opc == Op_SqrtD ||
-                 opc == Op_AbsF || opc == Op_AbsD ||
+                 opc == Op_AbsF || opc == Op_AbsD || opc == Op_AbsI ||
                  opc == Op_NegF || opc == Op_NegD ||
-                 opc == Op_PopCountI) {
+                 opc == Op_PopCountI || opc == Op_ConvI2F) {
         assert(n->req() == 2, "only one input expected");
         Node* in = vector_opd(p, 1);
         vn = VectorNode::make(opc, in, NULL, vlen, velt_basic_type(n));
@@ -3472,6 +3518,8 @@ void SuperWord::init() {
   _early_return = false;
   _num_work_vecs = 0;
   _num_reductions = 0;
+  _report_reason = NULL;
+  _report_opc = 0;
 }
 
 //------------------------------restart---------------------------
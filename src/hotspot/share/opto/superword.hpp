@@ -319,6 +319,8 @@ class SuperWord : public ResourceObj {
   bool           _do_reserve_copy; // do reserve copy of the graph(loop) before final modification in output
   int            _num_work_vecs;   // Number of non memory vector operations
   int            _num_reductions;  // Number of reduction expressions applied
+  const char*    _report_reason;   // First reason vectorization was given up, for PrintSuperWordReport
+  int            _report_opc;      // Scalar opcode of the first unimplemented pack, or 0
   int            _ii_first;        // generation with direct deps from mem phi
   int            _ii_last;         // generation with direct deps to   mem phi
   GrowableArray<int> _ii_order;
@@ -400,6 +402,10 @@ class SuperWord : public ResourceObj {
 
   // Extract the superword level parallelism
   void SLP_extract();
+  // Remember why the current loop is not vectorized (first reason wins)
+  void set_report_reason(const char* reason) { if (_report_reason == NULL) _report_reason = reason; }
+  // Print the PrintSuperWordReport line for the current loop
+  void print_report();
   // Find the adjacent memory references and create pack pairs for them.
   void find_adjacent_refs();
   // Tracing support
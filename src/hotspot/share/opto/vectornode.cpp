@@ -104,6 +104,13 @@ int VectorNode::opcode(int sopc, BasicType bt) {
   case Op_DivD:
     assert(bt == T_DOUBLE, "must be");
     return Op_DivVD;
+  case Op_MinI:
+    // Narrowed subword types would need sign-aware lane sizes; int only.
+    return (bt == T_INT) ? Op_MinVI : 0;
+  case Op_MaxI:
+    return (bt == T_INT) ? Op_MaxVI : 0;
+  case Op_AbsI:
+    return (bt == T_INT) ? Op_AbsVI : 0;
   case Op_AbsF:
     assert(bt == T_FLOAT, "must be");
     return Op_AbsVF;
@@ -122,6 +129,9 @@ int VectorNode::opcode(int sopc, BasicType bt) {
   case Op_SqrtD:
     assert(bt == T_DOUBLE, "must be");
     return Op_SqrtVD;
+  case Op_ConvI2F:
+    assert(bt == T_FLOAT, "must be");
+    return Op_VectorCastI2F;
   case Op_PopCountI:
     if (bt == T_INT) {
       return Op_PopCountVI;
@@ -298,6 +308,7 @@ void VectorNode::vector_operands(Node* n, uint* start, uint* end) {
   case Op_AndI: case Op_AndL:
   case Op_OrI:  case Op_OrL:
   case Op_XorI: case Op_XorL:
+  case Op_MinI: case Op_MaxI:
   case Op_MulAddS2I:
     *start = 1;
     *end   = 3; // 2 vector operands
@@ -347,6 +358,10 @@ VectorNode* VectorNode::make(int opc, Node* n1, Node* n2, uint vlen, BasicType b
   case Op_DivVF: return new DivVFNode(n1, n2, vt);
   case Op_DivVD: return new DivVDNode(n1, n2, vt);
 
+  case Op_MinVI: return new MinVINode(n1, n2, vt);
+  case Op_MaxVI: return new MaxVINode(n1, n2, vt);
+
+  case Op_AbsVI: return new AbsVINode(n1, vt);
   case Op_AbsVF: return new AbsVFNode(n1, vt);
   case Op_AbsVD: return new AbsVDNode(n1, vt);
 
@@ -358,6 +373,8 @@ VectorNode* VectorNode::make(int opc, Node* n1, Node* n2, uint vlen, BasicType b
 
   case Op_PopCountVI: return new PopCountVINode(n1, vt);
 
+  case Op_VectorCastI2F: return new VectorCastI2FNode(n1, vt);
+
   case Op_LShiftVB: return new LShiftVBNode(n1, n2, vt);
   case Op_LShiftVS: return new LShiftVSNode(n1, n2, vt);
   case Op_LShiftVI: return new LShiftVINode(n1, n2, vt);
@@ -582,6 +599,14 @@ int ReductionNode::opcode(int opc, BasicType bt) {
       assert(bt == T_DOUBLE, "must be");
       vopc = Op_MulReductionVD;
       break;
+    case Op_MinI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_MinReductionVI;
+      break;
+    case Op_MaxI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_MaxReductionVI;
+      break;
     // TODO: add MulL for targets that support it
     default:
       break;
@@ -606,6 +631,8 @@ ReductionNode* ReductionNode::make(int opc, Node *ctrl, Node* n1, Node* n2, Basi
   case Op_MulReductionVL: return new MulReductionVLNode(ctrl, n1, n2);
   case Op_MulReductionVF: return new MulReductionVFNode(ctrl, n1, n2);
   case Op_MulReductionVD: return new MulReductionVDNode(ctrl, n1, n2);
+  case Op_MinReductionVI: return new MinReductionVINode(ctrl, n1, n2);
+  case Op_MaxReductionVI: return new MaxReductionVINode(ctrl, n1, n2);
   default:
     fatal("Missed vector creation for '%s'", NodeClassNames[vopc]);
     return NULL;
@@ -617,7 +644,7 @@ bool ReductionNode::implemented(int opc, uint vlen, BasicType bt) {
       (vlen > 1) && is_power_of_2(vlen) &&
       Matcher::vector_size_supported(bt, vlen)) {
     int vopc = ReductionNode::opcode(opc, bt);
-    return vopc != opc && Matcher::match_rule_supported(vopc);
+    return vopc != opc && Matcher::match_rule_supported_vector(vopc, vlen);
   }
   return false;
 }
@@ -344,6 +344,42 @@ public:
   virtual uint ideal_reg() const { return Op_RegD; }
 };
 
+//------------------------------MinReductionVINode--------------------------------------
+// Vector min int as a reduction
+class MinReductionVINode : public ReductionNode {
+public:
+  MinReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------MaxReductionVINode--------------------------------------
+// Vector max int as a reduction
+class MaxReductionVINode : public ReductionNode {
+public:
+  MaxReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------MinVINode--------------------------------------
+// Vector min int
+class MinVINode : public VectorNode {
+ public:
+  MinVINode(Node* in1, Node* in2, const TypeVect* vt) : VectorNode(in1,in2,vt) {}
+  virtual int Opcode() const;
+};
+
+//------------------------------MaxVINode--------------------------------------
+// Vector max int
+class MaxVINode : public VectorNode {
+ public:
+  MaxVINode(Node* in1, Node* in2, const TypeVect* vt) : VectorNode(in1,in2,vt) {}
+  virtual int Opcode() const;
+};
+
 //------------------------------DivVFNode--------------------------------------
 // Vector divide float
 class DivVFNode : public VectorNode {
@@ -368,6 +404,14 @@ class AbsVFNode : public VectorNode {
   virtual int Opcode() const;
 };
 
+//------------------------------AbsVINode--------------------------------------
+// Vector Abs int
+class AbsVINode : public VectorNode {
+ public:
+  AbsVINode(Node* in, const TypeVect* vt) : VectorNode(in,vt) {}
+  virtual int Opcode() const;
+};
+
 //------------------------------AbsVDNode--------------------------------------
 // Vector Abs double
 class AbsVDNode : public VectorNode {
@@ -400,6 +444,14 @@ class PopCountVINode : public VectorNode {
   virtual int Opcode() const;
 };
 
+//------------------------------VectorCastI2FNode-------------------------------
+// Vector convert int to float
+class VectorCastI2FNode : public VectorNode {
+ public:
+  VectorCastI2FNode(Node* in, const TypeVect* vt) : VectorNode(in,vt) {}
+  virtual int Opcode() const;
+};
+
 //------------------------------SqrtVFNode--------------------------------------
 // Vector Sqrt float
 class SqrtVFNode : public VectorNode {
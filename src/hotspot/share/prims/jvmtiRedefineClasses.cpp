@@ -26,6 +26,7 @@
 #include "aot/aotLoader.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/classFileStream.hpp"
+#include "classfile/javaClasses.hpp"
 #include "classfile/metadataOnStackMark.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/verifier.hpp"
@@ -223,6 +224,9 @@ void VM_RedefineClasses::doit() {
   // Disable any dependent concurrent compilations
   SystemDictionary::notice_modification();
 
+  // Drop shared backtraces of throwables referring to old methods
+  java_lang_Throwable::flush_shared_backtraces();
+
   // Set flag indicating that some invariants are no longer true.
   // See jvmtiExport.hpp for detailed explanation.
   JvmtiExport::set_has_redefined_a_class();
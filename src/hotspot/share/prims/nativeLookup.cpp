@@ -83,10 +83,10 @@ char* NativeLookup::pure_jni_name(const methodHandle& method) {
 }
 
 
-char* NativeLookup::critical_jni_name(const methodHandle& method) {
+char* NativeLookup::critical_jni_name(const methodHandle& method, const char* prefix) {
   stringStream st;
   // Prefix
-  st.print("JavaCritical_");
+  st.print("%s", prefix);
   // Klass name
   mangle_name_on(&st, method->klass_name());
   st.print("_");
@@ -276,7 +276,18 @@ address NativeLookup::lookup_entry(const methodHandle& method, bool& in_base_lib
 // for the specified method.
 address NativeLookup::lookup_critical_entry(const methodHandle& method) {
   if (!CriticalJNINatives) return NULL;
+  return lookup_critical_entry(method, "JavaCritical_");
+}
+
+// Trivial natives use the calling convention of critical natives but
+// promise not to block, not to call back into the VM and to return quickly,
+// so they can be called without any thread state transition.
+address NativeLookup::lookup_trivial_entry(const methodHandle& method) {
+  if (!TrivialJNINatives) return NULL;
+  return lookup_critical_entry(method, "JavaTrivial_");
+}
 
+address NativeLookup::lookup_critical_entry(const methodHandle& method, const char* prefix) {
   if (method->is_synchronized() ||
       !method->is_static()) {
     // Only static non-synchronized methods are allowed
@@ -295,7 +306,7 @@ address NativeLookup::lookup_critical_entry(const methodHandle& method) {
   }
 
   // Compute critical name
-  char* critical_name = critical_jni_name(method);
+  char* critical_name = critical_jni_name(method, prefix);
 
   // Compute argument size
   int args_size = method->size_of_parameters();
@@ -36,7 +36,7 @@ class NativeLookup : AllStatic {
   // JNI name computation
   static char* pure_jni_name(const methodHandle& method);
   static char* long_jni_name(const methodHandle& method);
-  static char* critical_jni_name(const methodHandle& method);
+  static char* critical_jni_name(const methodHandle& method, const char* prefix);
 
   // Style specific lookup
   static address lookup_style(const methodHandle& method, char* pure_name, const char* long_name, int args_size, bool os_style, bool& in_base_library, TRAPS);
@@ -44,10 +44,12 @@ class NativeLookup : AllStatic {
   static address lookup_base (const methodHandle& method, bool& in_base_library, TRAPS);
   static address lookup_entry(const methodHandle& method, bool& in_base_library, TRAPS);
   static address lookup_entry_prefixed(const methodHandle& method, bool& in_base_library, TRAPS);
+  static address lookup_critical_entry(const methodHandle& method, const char* prefix);
  public:
   // Lookup native function. May throw UnsatisfiedLinkError.
   static address lookup(const methodHandle& method, bool& in_base_library, TRAPS);
   static address lookup_critical_entry(const methodHandle& method);
+  static address lookup_trivial_entry(const methodHandle& method);
 
   // Lookup native functions in base library.
   static address base_library_lookup(const char* class_name, const char* method_name, const char* signature);
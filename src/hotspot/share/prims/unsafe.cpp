@@ -392,6 +392,24 @@ UNSAFE_ENTRY(void, Unsafe_FreeMemory0(JNIEnv *env, jobject unsafe, jlong addr))
   os::free(p);
 } UNSAFE_END
 
+// Chunks of jdk.internal.misc.NativeArena. The arena bump-allocates from
+// them in Java and frees all of them at once, so they are only malloc'ed
+// separately from allocateMemory0 to be accounted for separately by NMT.
+UNSAFE_ENTRY(jlong, Unsafe_AllocateArenaChunk0(JNIEnv *env, jobject unsafe, jlong size)) {
+  size_t sz = (size_t)size;
+
+  sz = align_up(sz, HeapWordSize);
+  void* x = os::malloc(sz, mtNativeArena);
+
+  return addr_to_java(x);
+} UNSAFE_END
+
+UNSAFE_ENTRY(void, Unsafe_FreeArenaChunk0(JNIEnv *env, jobject unsafe, jlong addr)) {
+  void* p = addr_from_java(addr);
+
+  os::free(p);
+} UNSAFE_END
+
 UNSAFE_ENTRY(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject obj, jlong offset, jlong size, jbyte value)) {
   size_t sz = (size_t)size;
 
@@ -1063,6 +1081,8 @@ static JNINativeMethod jdk_internal_misc_Unsafe_methods[] = {
     {CC "allocateMemory0",    CC "(J)" ADR,              FN_PTR(Unsafe_AllocateMemory0)},
     {CC "reallocateMemory0",  CC "(" ADR "J)" ADR,       FN_PTR(Unsafe_ReallocateMemory0)},
     {CC "freeMemory0",        CC "(" ADR ")V",           FN_PTR(Unsafe_FreeMemory0)},
+    {CC "allocateArenaChunk0", CC "(J)" ADR,             FN_PTR(Unsafe_AllocateArenaChunk0)},
+    {CC "freeArenaChunk0",    CC "(" ADR ")V",           FN_PTR(Unsafe_FreeArenaChunk0)},
 
     {CC "objectFieldOffset0", CC "(" FLD ")J",           FN_PTR(Unsafe_ObjectFieldOffset0)},
     {CC "objectFieldOffset1", CC "(" CLS LANG "String;)J", FN_PTR(Unsafe_ObjectFieldOffset1)},
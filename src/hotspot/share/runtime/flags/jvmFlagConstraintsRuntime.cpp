@@ -131,6 +131,20 @@ JVMFlag::Error PerfDataSamplingIntervalFunc(intx value, bool verbose) {
   }
 }
 
+JVMFlag::Error ActiveProcessorCountUpdateIntervalFunc(intx value, bool verbose) {
+  if (value != 0 &&
+      (value < PeriodicTask::min_interval || (value % PeriodicTask::interval_gran) != 0)) {
+    JVMFlag::printError(verbose,
+                        "ActiveProcessorCountUpdateInterval (" INTX_FORMAT ") must be "
+                        "zero or at least %d and evenly divisible by "
+                        "PeriodicTask::interval_gran (%d)\n",
+                        value, PeriodicTask::min_interval, PeriodicTask::interval_gran);
+    return JVMFlag::VIOLATES_CONSTRAINT;
+  } else {
+    return JVMFlag::SUCCESS;
+  }
+}
+
 JVMFlag::Error ThreadLocalHandshakesConstraintFunc(bool value, bool verbose) {
   if (value) {
     if (!SafepointMechanism::supports_thread_local_poll()) {
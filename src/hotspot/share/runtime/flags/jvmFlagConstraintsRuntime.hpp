@@ -43,6 +43,7 @@ JVMFlag::Error BiasedLockingBulkRevokeThresholdFunc(intx value, bool verbose);
 JVMFlag::Error BiasedLockingDecayTimeFunc(intx value, bool verbose);
 
 JVMFlag::Error PerfDataSamplingIntervalFunc(intx value, bool verbose);
+JVMFlag::Error ActiveProcessorCountUpdateIntervalFunc(intx value, bool verbose);
 
 JVMFlag::Error ThreadLocalHandshakesConstraintFunc(bool value, bool verbose);
 
@@ -260,6 +260,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   diagnostic(uint, HandshakeTimeout, 0,                                     \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
+  diagnostic(uint, ParallelHandshakeThreshold, 64,                          \
+          "Minimum number of threads for the VM thread to process "         \
+          "handshakes of blocked threads with the help of the GC's "        \
+          "safepoint workers (0 disables)")                                 \
+                                                                            \
   experimental(bool, AlwaysSafeConstructors, false,                         \
           "Force safe construction, as if all fields are final.")           \
                                                                             \
@@ -432,6 +437,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   notproduct(bool, StressCriticalJNINatives, false,                         \
           "Exercise register saving code in critical natives")              \
                                                                             \
+  experimental(bool, TrivialJNINatives, false,                              \
+          "Check for trivial JNI entry points (JavaTrivial_ prefix) and "   \
+          "call them without thread state transitions")                     \
+                                                                            \
   diagnostic(bool, UseAESIntrinsics, false,                                 \
           "Use intrinsics for AES versions of crypto")                      \
                                                                             \
@@ -742,6 +751,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, StackTraceInThrowable, true,                                \
           "Collect backtrace in throwable when exception happens")          \
                                                                             \
+  product(bool, ShareThrowableBacktraces, false,                            \
+          "Share the backtrace and the StackTraceElements of throwables "   \
+          "created with identical stack traces")                            \
+                                                                            \
   product(bool, OmitStackTraceInFastThrow, true,                            \
           "Omit backtraces for some 'hot' exceptions in optimized code")    \
                                                                             \
@@ -893,6 +906,13 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "where <= 0 is unlimited, default: 65536")                        \
           range(min_intx, max_intx)                                         \
                                                                             \
+  product(uintx, JNIGlobalHandleThreadCacheSize, 0,                         \
+          "Number of free JNI global and weak global handles each thread "  \
+          "may cache, to reduce contention when handles are created and "   \
+          "deleted by many threads. Zero disables the caches. Ignored "     \
+          "with -Xcheck:jni")                                               \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, EagerXrunInit, false,                                       \
           "Eagerly initialize -Xrun libraries; allows startup profiling, "  \
           "but not all -Xrun libraries may support the state of the VM "    \
@@ -917,9 +937,17 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, CompactFields, true,                                        \
           "Allocate nonstatic fields in gaps between previous fields")      \
                                                                             \
-  notproduct(bool, PrintFieldLayout, false,                                 \
+  diagnostic(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
+  product(bool, UseNewFieldLayout, false,                                   \
+          "Use the field layout builder, which packs fields in the gaps "   \
+          "left by super classes, instead of FieldsAllocationStyle")        \
+                                                                            \
+  product(bool, UseEmptySlotsInSupers, false,                               \
+          "Allow allocation of fields in empty slots of super-classes "     \
+          "(only with UseNewFieldLayout)")                                  \
+                                                                            \
   /* Need to limit the extent of the padding to reasonable size.          */\
   /* 8K is well beyond the reasonable HW cache line size, even with       */\
   /* aggressive prefetching, while still leaving the room for segregating */\
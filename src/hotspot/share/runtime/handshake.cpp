@@ -23,9 +23,13 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/orderAccess.hpp"
@@ -85,6 +89,13 @@ class VM_Handshake: public VM_Operation {
 
   bool handshake_has_timed_out(jlong start_time);
   static void handle_timeout();
+
+  void log_completion(jlong start_time, int targets, int vmthread_executed) {
+    log_info(handshake)("Handshake \"%s\", Targeted threads: %d, Executed by targeted threads: %d, "
+                        "Total completion time: " JLONG_FORMAT " ns",
+                        name(), targets, targets - vmthread_executed,
+                        (jlong)(TimeHelper::counter_to_seconds(os::elapsed_counter() - start_time) * NANOSECS_PER_SEC));
+  }
 };
 
 bool VM_Handshake::handshake_has_timed_out(jlong start_time) {
@@ -116,7 +127,7 @@ class VM_HandshakeOneThread: public VM_Handshake {
 
   void doit() {
     DEBUG_ONLY(_op->check_state();)
-    TraceTime timer("Performing single-target operation (vmoperation doit)", TRACETIME_LOG(Info, handshake));
+    jlong start_time = os::elapsed_counter();
 
     ThreadsListHandle tlh;
     if (tlh.includes(_target)) {
@@ -127,7 +138,7 @@ class VM_HandshakeOneThread: public VM_Handshake {
     }
 
     log_trace(handshake)("Thread signaled, begin processing by VMThtread");
-    jlong start_time = os::elapsed_counter();
+    int vmthread_executed = 0;
     do {
       if (handshake_has_timed_out(start_time)) {
         handle_timeout();
@@ -138,10 +149,13 @@ class VM_HandshakeOneThread: public VM_Handshake {
       // locked during certain phases.
       {
         MutexLockerEx ml(Threads_lock, Mutex::_no_safepoint_check_flag);
-        _target->handshake_process_by_vmthread();
+        if (_target->handshake_process_by_vmthread()) {
+          vmthread_executed++;
+        }
       }
     } while (!poll_for_completed_thread());
     DEBUG_ONLY(_op->check_state();)
+    log_completion(start_time, 1, vmthread_executed);
   }
 
   VMOp_Type type() const { return VMOp_HandshakeOneThread; }
@@ -149,13 +163,63 @@ class VM_HandshakeOneThread: public VM_Handshake {
   bool thread_alive() const { return _thread_alive; }
 };
 
+// Processes the handshakes of the blocked threads in a ThreadsList with the
+// help of worker threads. The VM thread holds the Threads_lock meanwhile.
+class HandshakeBlockedThreadsTask : public AbstractGangTask {
+  ThreadsList* const _list;
+  volatile uint _claimed;
+  volatile int _executed;
+
+ public:
+  HandshakeBlockedThreadsTask(ThreadsList* list) :
+      AbstractGangTask("Handshake Blocked Threads"), _list(list), _claimed(0), _executed(0) {}
+
+  void work(uint worker_id) {
+    int executed = 0;
+    for (uint i = Atomic::add(1u, &_claimed) - 1; i < _list->length(); i = Atomic::add(1u, &_claimed) - 1) {
+      if (_list->thread_at(i)->handshake_process_by_vmthread()) {
+        executed++;
+      }
+    }
+    if (executed > 0) {
+      Atomic::add(executed, &_executed);
+    }
+  }
+
+  int executed() const { return _executed; }
+};
+
 class VM_HandshakeAllThreads: public VM_Handshake {
+  // Have the VM thread, and workers if there are many threads, perform the
+  // handshake operation for blocked threads. Returns the number of
+  // operations executed.
+  int process_blocked_threads(JavaThreadIteratorWithHandle* jtiwh) {
+    WorkGang* workers = Universe::heap()->get_safepoint_workers();
+    if (workers != NULL && ParallelHandshakeThreshold > 0 &&
+        jtiwh->length() >= ParallelHandshakeThreshold) {
+      HandshakeBlockedThreadsTask task(jtiwh->list());
+      workers->run_task(&task);
+      return task.executed();
+    }
+
+    int executed = 0;
+    jtiwh->rewind();
+    for (JavaThread *thr = jtiwh->next(); thr != NULL; thr = jtiwh->next()) {
+      // A new thread on the ThreadsList will not have an operation,
+      // hence it is skipped in handshake_process_by_vmthread.
+      if (thr->handshake_process_by_vmthread()) {
+        executed++;
+      }
+    }
+    return executed;
+  }
+
  public:
   VM_HandshakeAllThreads(HandshakeThreadsOperation* op) : VM_Handshake(op) {}
 
   void doit() {
     DEBUG_ONLY(_op->check_state();)
-    TraceTime timer("Performing operation (vmoperation doit)", TRACETIME_LOG(Info, handshake));
+    const jlong start_time = os::elapsed_counter();
 
     JavaThreadIteratorWithHandle jtiwh;
     int number_of_threads_issued = 0;
@@ -170,8 +234,8 @@ class VM_HandshakeAllThreads: public VM_Handshake {
     }
 
     log_debug(handshake)("Threads signaled, begin processing blocked threads by VMThtread");
-    const jlong start_time = os::elapsed_counter();
     int number_of_threads_completed = 0;
+    int number_of_threads_executed_by_vmthread = 0;
     do {
       // Check if handshake operation has timed out
       if (handshake_has_timed_out(start_time)) {
@@ -185,13 +249,8 @@ class VM_HandshakeAllThreads: public VM_Handshake {
           // We need to re-think this with SMR ThreadsList.
           // There is an assumption in the code that the Threads_lock should
           // be locked during certain phases.
-          jtiwh.rewind();
           MutexLockerEx ml(Threads_lock, Mutex::_no_safepoint_check_flag);
-          for (JavaThread *thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
-            // A new thread on the ThreadsList will not have an operation,
-            // hence it is skipped in handshake_process_by_vmthread.
-            thr->handshake_process_by_vmthread();
-          }
+          number_of_threads_executed_by_vmthread += process_blocked_threads(&jtiwh);
       }
 
       while (poll_for_completed_thread()) {
@@ -202,6 +261,7 @@ class VM_HandshakeAllThreads: public VM_Handshake {
     } while (number_of_threads_issued > number_of_threads_completed);
     assert(number_of_threads_issued == number_of_threads_completed, "Must be the same");
     DEBUG_ONLY(_op->check_state();)
+    log_completion(start_time, number_of_threads_issued, number_of_threads_executed_by_vmthread);
   }
 
   VMOp_Type type() const { return VMOp_HandshakeAllThreads; }
@@ -235,8 +295,9 @@ public:
 
 void HandshakeThreadsOperation::do_handshake(JavaThread* thread) {
   ResourceMark rm;
-  FormatBufferResource message("Operation for thread " PTR_FORMAT ", is_vm_thread: %s",
-                               p2i(thread), BOOL_TO_STR(Thread::current()->is_VM_thread()));
+  FormatBufferResource message("Operation for thread " PTR_FORMAT ", is_vm_thread: %s, is_worker_thread: %s",
+                               p2i(thread), BOOL_TO_STR(Thread::current()->is_VM_thread()),
+                               BOOL_TO_STR(Thread::current()->is_Worker_thread()));
   TraceTime timer(message, TRACETIME_LOG(Debug, handshake, task));
 
   // Only actually execute the operation for non terminated threads.
@@ -307,7 +368,7 @@ bool HandshakeState::vmthread_can_process_handshake(JavaThread* target) {
   // suspended thread to be safe. However, this function must be called with
   // the Threads_lock held so an externally suspended thread cannot be
   // resumed thus it is safe.
-  assert(Threads_lock->owned_by_self(), "Not holding Threads_lock.");
+  assert(Threads_lock->owner() == VMThread::vm_thread(), "VM thread not holding Threads_lock.");
   return SafepointSynchronize::safepoint_safe(target, target->thread_state()) ||
          target->is_ext_suspended() || target->is_terminated();
 }
@@ -316,7 +377,7 @@ static bool possibly_vmthread_can_process_handshake(JavaThread* target) {
   // An externally suspended thread cannot be resumed while the
   // Threads_lock is held so it is safe.
   // Note that this method is allowed to produce false positives.
-  assert(Threads_lock->owned_by_self(), "Not holding Threads_lock.");
+  assert(Threads_lock->owner() == VMThread::vm_thread(), "VM thread not holding Threads_lock.");
   if (target->is_ext_suspended()) {
     return true;
   }
@@ -347,26 +408,29 @@ bool HandshakeState::claim_handshake_for_vmthread() {
   return false;
 }
 
-void HandshakeState::process_by_vmthread(JavaThread* target) {
-  assert(Thread::current()->is_VM_thread(), "should call from vm thread");
-  // Threads_lock must be held here, but that is assert()ed in
-  // possibly_vmthread_can_process_handshake().
+bool HandshakeState::process_by_vmthread(JavaThread* target) {
+  assert(Thread::current()->is_VM_thread() || Thread::current()->is_Worker_thread(),
+         "should call from vm thread or its workers");
+  // Threads_lock must be held by the VM thread here, but that is assert()ed
+  // in possibly_vmthread_can_process_handshake().
 
   if (!has_operation()) {
     // JT has already cleared its handshake
-    return;
+    return false;
   }
 
   if (!possibly_vmthread_can_process_handshake(target)) {
     // JT is observed in an unsafe state, it must notice the handshake itself
-    return;
+    return false;
   }
 
   // Claim the semaphore if there still an operation to be executed.
   if (!claim_handshake_for_vmthread()) {
-    return;
+    return false;
   }
 
+  bool executed = false;
+
   // If we own the semaphore at this point and while owning the semaphore
   // can observe a safe state the thread cannot possibly continue without
   // getting caught by the semaphore.
@@ -375,8 +439,10 @@ void HandshakeState::process_by_vmthread(JavaThread* target) {
     _operation->do_handshake(target);
     // Disarm after VM thread have executed the operation.
     clear_handshake(target);
+    executed = true;
     // Release the thread
   }
 
   _semaphore.signal();
+  return executed;
 }
@@ -78,7 +78,8 @@ public:
     }
   }
 
-  void process_by_vmthread(JavaThread* target);
+  // Returns true if the operation was executed by the calling thread.
+  bool process_by_vmthread(JavaThread* target);
 };
 
 #endif // SHARE_VM_RUNTIME_HANDSHAKE_HPP
@@ -207,6 +207,12 @@ void JNIHandles::initialize() {
   _weak_global_handles = new OopStorage("JNI Weak",
                                         JNIWeakAlloc_lock,
                                         JNIWeakActive_lock);
+  // Cached free entries are still allocated in their storage, so the
+  // handle checks of -Xcheck:jni could not detect a deleted handle.
+  if (!CheckJNICalls) {
+    _global_handles->enable_thread_caches((uint)JNIGlobalHandleThreadCacheSize);
+    _weak_global_handles->enable_thread_caches((uint)JNIGlobalHandleThreadCacheSize);
+  }
 }
 
 
@@ -54,6 +54,7 @@
 #include "runtime/os.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/task.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vm_version.hpp"
@@ -74,6 +75,7 @@ address           os::_polling_page       = NULL;
 volatile unsigned int os::_rand_seed      = 1;
 int               os::_processor_count    = 0;
 int               os::_initial_active_processor_count = 0;
+volatile int      os::_sampled_active_processor_count = 0;
 size_t            os::_page_sizes[os::page_sizes_max];
 
 #ifndef PRODUCT
@@ -1628,9 +1630,55 @@ bool os::is_server_class_machine() {
 void os::initialize_initial_active_processor_count() {
   assert(_initial_active_processor_count == 0, "Initial active processor count already set.");
   _initial_active_processor_count = active_processor_count();
+  _sampled_active_processor_count = _initial_active_processor_count;
   log_debug(os)("Initial active processor count set to %d" , _initial_active_processor_count);
 }
 
+bool os::update_active_processor_count() {
+  int old_count = _sampled_active_processor_count;
+  int new_count = active_processor_count();
+  if (new_count == old_count) {
+    return false;
+  }
+  _sampled_active_processor_count = new_count;
+  log_info(os)("Active processor count changed from %d to %d", old_count, new_count);
+  Events::log(NULL, "Active processor count changed from %d to %d", old_count, new_count);
+  return true;
+}
+
+class ActiveProcessorCountUpdateTask : public PeriodicTask {
+ public:
+  ActiveProcessorCountUpdateTask(size_t interval_time) : PeriodicTask(interval_time) {}
+
+  virtual void task() {
+    os::update_active_processor_count();
+  }
+};
+
+void os::engage_active_processor_count_updates() {
+  if (ActiveProcessorCountUpdateInterval > 0 && ActiveProcessorCount <= 0) {
+    ActiveProcessorCountUpdateTask* task =
+      new ActiveProcessorCountUpdateTask(ActiveProcessorCountUpdateInterval);
+    task->enroll();
+  }
+}
+
+int os::max_active_processor_count() {
+  if (ActiveProcessorCountUpdateInterval > 0 && ActiveProcessorCount <= 0) {
+    return MAX2(processor_count(), initial_active_processor_count());
+  }
+  return initial_active_processor_count();
+}
+
+uint os::scale_to_active_processors(uint count) {
+  uint max_count = (uint)max_active_processor_count();
+  uint cur_count = MIN2((uint)sampled_active_processor_count(), max_count);
+  if (cur_count == max_count) {
+    return count;
+  }
+  return MAX2(1u, (uint)(((julong)count * cur_count + max_count - 1) / max_count));
+}
+
 void os::SuspendedThreadTask::run() {
   internal_do_task();
   _done = true;
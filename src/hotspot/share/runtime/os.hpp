@@ -262,6 +262,32 @@ class os: AllStatic {
     return _initial_active_processor_count;
   }
 
+  // The active processor count as of the last update_active_processor_count().
+  // Unless ActiveProcessorCountUpdateInterval is set, this is the initial
+  // active processor count.
+  static int sampled_active_processor_count() {
+    assert(_sampled_active_processor_count > 0, "Active processor count not sampled yet.");
+    return _sampled_active_processor_count;
+  }
+
+  // Re-evaluates active_processor_count(), e.g. after the CPU quota of the
+  // container has been changed, and logs a change. Returns true if the
+  // count differs from the previous sample.
+  static bool update_active_processor_count();
+
+  // Starts periodic calls to update_active_processor_count().
+  static void engage_active_processor_count_updates();
+
+  // The number of processors that thread pools which follow changes of the
+  // active processor count should be sized for. This is the total processor
+  // count if ActiveProcessorCountUpdateInterval is set, and the initial active
+  // processor count otherwise.
+  static int max_active_processor_count();
+
+  // Scales count, chosen for max_active_processor_count() processors, to the
+  // sampled active processor count. The result is at least 1.
+  static uint scale_to_active_processors(uint count);
+
   // Bind processes to processors.
   //     This is a two step procedure:
   //     first you generate a distribution of processes to processors,
@@ -368,6 +394,9 @@ class os: AllStatic {
   static bool   unguard_memory(char* addr, size_t bytes);
   static bool   create_stack_guard_pages(char* addr, size_t bytes);
   static bool   pd_create_stack_guard_pages(char* addr, size_t bytes);
+  // True if the stack guard zone of the current thread is already in place
+  // and protected when the thread starts, e.g. on a reused stack.
+  static bool   stack_guard_pages_protected(char* addr, size_t bytes);
   static bool   remove_stack_guard_pages(char* addr, size_t bytes);
   // Helper function to create a new file with template jvmheap.XXXXXX.
   // Returns a valid fd on success or else returns -1
@@ -974,6 +1003,7 @@ class os: AllStatic {
   static volatile unsigned int _rand_seed;    // seed for random number generator
   static int _processor_count;                // number of processors
   static int _initial_active_processor_count; // number of active processors during initialization.
+  static volatile int _sampled_active_processor_count; // number of active processors as of the last update.
 
   static char* format_boot_path(const char* format_string,
                                 const char* home,
@@ -36,6 +36,7 @@
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/gcId.hpp"
 #include "gc/shared/gcLocker.inline.hpp"
+#include "gc/shared/oopStorage.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/linkResolver.hpp"
@@ -228,6 +229,7 @@ Thread::Thread() {
   DEBUG_ONLY(_current_resource_mark = NULL;)
   set_handle_area(new (mtThread) HandleArea(NULL));
   set_metadata_handles(new (ResourceObj::C_HEAP, mtClass) GrowableArray<Metadata*>(30, true));
+  _oop_storage_cache = NULL;
   set_active_handles(NULL);
   set_free_handle_block(NULL);
   set_last_handle_mark(NULL);
@@ -437,6 +439,10 @@ Thread::~Thread() {
   delete handle_area();
   delete metadata_handles();
 
+  // Return cached OopStorage entries.
+  delete _oop_storage_cache;
+  _oop_storage_cache = NULL;
+
   // SR_handler uses this as a termination indicator -
   // needs to happen before os::free_thread()
   delete _SR_lock;
@@ -1589,6 +1595,8 @@ void JavaThread::initialize() {
   _is_method_handle_return = 0;
   _jvmti_thread_state= NULL;
   _should_post_on_exceptions_flag = JNI_FALSE;
+  _profile_sample_countdown = 0;
+  _profile_sample_seed = os::random() | 1; // xorshift state must not be 0
   _interp_only_mode    = 0;
   _special_runtime_exit_condition = _no_async_condition;
   _pending_async_exception = NULL;
@@ -2548,6 +2556,15 @@ void JavaThread::create_stack_guard_pages() {
   assert(is_aligned(low_addr, os::vm_page_size()), "Stack base should be the start of a page");
   assert(is_aligned(len, os::vm_page_size()), "Stack size should be a multiple of page size");
 
+  if (os::stack_guard_pages_protected((char *) low_addr, len)) {
+    // Reused stack, its guard zone is still in place.
+    _stack_guard_state = stack_guard_enabled;
+    log_debug(os, thread)("Thread " UINTX_FORMAT " stack guard pages reused: "
+      PTR_FORMAT "-" PTR_FORMAT ".",
+      os::current_thread_id(), p2i(low_addr), p2i(low_addr + len));
+    return;
+  }
+
   int must_commit = os::must_commit_stack_guard_pages();
   // warning("Guarding at " PTR_FORMAT " for len " SIZE_FORMAT "\n", low_addr, len);
 
@@ -3926,6 +3943,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   if (MemProfiling)                   MemProfiler::engage();
   StatSampler::engage();
   if (CheckJNICalls)                  JniPeriodicChecker::engage();
+  os::engage_active_processor_count_updates();
 
   BiasedLocking::init();
 
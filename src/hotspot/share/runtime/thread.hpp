@@ -85,6 +85,7 @@ class ICRefillVerifier;
 class IdealGraphPrinter;
 
 class Metadata;
+class OopStorageThreadCache;
 template <class T, MEMFLAGS F> class ChunkedList;
 typedef ChunkedList<Metadata*, mtInternal> MetadataOnStackBuffer;
 
@@ -542,6 +543,9 @@ class Thread: public ThreadShadow {
   GrowableArray<Metadata*>* metadata_handles() const          { return _metadata_handles; }
   void set_metadata_handles(GrowableArray<Metadata*>* handles){ _metadata_handles = handles; }
 
+  OopStorageThreadCache* oop_storage_cache() const            { return _oop_storage_cache; }
+  void set_oop_storage_cache(OopStorageThreadCache* cache)    { _oop_storage_cache = cache; }
+
   // Thread-Local Allocation Buffer (TLAB) support
   ThreadLocalAllocBuffer& tlab()                 { return _tlab; }
   void initialize_tlab() {
@@ -647,6 +651,9 @@ protected:
   HandleArea* _handle_area;
   GrowableArray<Metadata*>* _metadata_handles;
 
+  // Cached free OopStorage entries, created on first use
+  OopStorageThreadCache* _oop_storage_cache;
+
   // Support for stack overflow handling, get_thread, etc.
   address          _stack_base;
   size_t           _stack_size;
@@ -1291,8 +1298,8 @@ class JavaThread: public Thread {
     _handshake.process_by_self(this);
   }
 
-  void handshake_process_by_vmthread() {
-    _handshake.process_by_vmthread(this);
+  bool handshake_process_by_vmthread() {
+    return _handshake.process_by_vmthread(this);
   }
 
   // Suspend/resume support for JavaThread
@@ -1986,6 +1993,20 @@ class JavaThread: public Thread {
   int   should_post_on_exceptions_flag()  { return _should_post_on_exceptions_flag; }
   void  set_should_post_on_exceptions_flag(int val)  { _should_post_on_exceptions_flag = val; }
 
+  // Countdown used by Tier3 code to sample profile updates (see C1ProfileSampleInterval),
+  // and the xorshift state that jitters its reset value
+ private:
+  int    _profile_sample_countdown;
+  int    _profile_sample_seed;
+
+ public:
+  static ByteSize profile_sample_countdown_offset() {
+    return byte_offset_of(JavaThread, _profile_sample_countdown);
+  }
+  static ByteSize profile_sample_seed_offset() {
+    return byte_offset_of(JavaThread, _profile_sample_seed);
+  }
+
  private:
   ThreadStatistics *_thread_stat;
 
@@ -226,7 +226,11 @@ void TieredThresholdPolicy::initialize() {
   }
   if (CICompilerCountPerCPU) {
     // Simple log n seems to grow too slowly for tiered, try something faster: log n * log log n
-    int log_cpu = log2_int(os::active_processor_count());
+    // Dynamically started compiler threads are provisioned for all processors
+    // the VM may be given later on.
+    int ncpus = UseDynamicNumberOfCompilerThreads ? os::max_active_processor_count()
+                                                  : os::active_processor_count();
+    int log_cpu = log2_int(ncpus);
     int loglog_cpu = log2_int(MAX2(log_cpu, 1));
     count = MAX2(log_cpu * loglog_cpu * 3 / 2, 2);
     // Make sure there is enough space in the code cache to hold all the compiler buffers
@@ -258,6 +258,7 @@ jint dump_heap(AttachOperation* op, outputStream* out) {
 //
 // Input arguments :-
 //   arg0: "-live" or "-all"
+//   arg1: number of GC worker threads to walk the heap with, 0 for all
 static jint heap_inspection(AttachOperation* op, outputStream* out) {
   bool live_objects_only = true;   // default is true to retain the behavior before this change is made
   const char* arg0 = op->arg(0);
@@ -268,7 +269,18 @@ static jint heap_inspection(AttachOperation* op, outputStream* out) {
     }
     live_objects_only = strcmp(arg0, "-live") == 0;
   }
-  VM_GC_HeapInspection heapop(out, live_objects_only /* request full gc */);
+  uint parallel_thread_num = 0;
+  const char* arg1 = op->arg(1);
+  if (arg1 != NULL && (strlen(arg1) > 0)) {
+    julong num;
+    if (!Arguments::atojulong(arg1, &num) || num > max_juint) {
+      out->print_cr("Invalid parallel thread number: [%s]", arg1);
+      return JNI_ERR;
+    }
+    parallel_thread_num = (uint)num;
+  }
+  VM_GC_HeapInspection heapop(out, live_objects_only /* request full gc */,
+                              parallel_thread_num);
   VMThread::execute(&heapop);
   return JNI_OK;
 }
@@ -56,6 +56,11 @@ public final class StackTraceElement implements java.io.Serializable {
     // reference to the declaring Class.  The Class reference is used to
     // construct the 'format' bitmap, and then is cleared.
     //
+    // A null value thus means that the format has been computed. With
+    // -XX:+ShareThrowableBacktraces the VM hands out the same elements for
+    // throwables with identical stack traces, so computeFormat() may be
+    // called again on an element that is already initialized.
+    //
     // For STEs constructed using the public constructors, this field is not used.
     private transient Class<?> declaringClassObject;
 
@@ -418,6 +423,9 @@ public final class StackTraceElement implements java.io.Serializable {
     /**
      * Called from of() methods to set the 'format' bitmap using the Class
      * reference stored in declaringClassObject, and then clear the reference.
+     * Does nothing if the reference was already cleared, that is, if this
+     * element is shared with another stack trace and its format has been
+     * computed (see the comment on declaringClassObject).
      *
      * <p>
      * If the module is a non-upgradeable JDK module, then set
@@ -427,8 +435,11 @@ public final class StackTraceElement implements java.io.Serializable {
      * then set BUILTIN_CLASS_LOADER to omit the first element (`<loader>/`).
      */
     private synchronized void computeFormat() {
+        Class<?> cls = (Class<?>) declaringClassObject;
+        if (cls == null) {
+            return;   // shared element, format already computed
+        }
         try {
-            Class<?> cls = (Class<?>) declaringClassObject;
             ClassLoader loader = cls.getClassLoader0();
             Module m = cls.getModule();
             byte bits = 0;
@@ -522,7 +533,9 @@ public final class StackTraceElement implements java.io.Serializable {
             stackTrace[i] = new StackTraceElement();
         }
 
-        // VM to fill in StackTraceElement
+        // VM to fill in StackTraceElement. It may instead store elements
+        // it created for an identical stack trace, which can be shared
+        // because they are immutable once initialized.
         initStackTraceElements(stackTrace, x);
 
         // ensure the proper StackTraceElement initialization
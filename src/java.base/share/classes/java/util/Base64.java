@@ -694,6 +694,38 @@ public class Base64 {
             return 3 * ((len + 3) / 4) - paddings;
         }
 
+        /*
+         * Decodes the complete 4-byte atoms of src[sp, sl) into dst starting
+         * at dp, stopping in front of the first atom that contains a byte
+         * outside of the alphabet (padding included). Returns the number of
+         * bytes written, which is always a multiple of 3. Whatever is left,
+         * including the reporting of errors, is up to the caller.
+         *
+         * isMIME is not needed here, but is passed on for the benefit of
+         * intrinsic implementations of this method.
+         */
+        @HotSpotIntrinsicCandidate
+        private int decodeBlock(byte[] src, int sp, int sl, byte[] dst, int dp,
+                                boolean isURL, boolean isMIME) {
+            int[] base64 = isURL ? fromBase64URL : fromBase64;
+            int sl0 = sp + ((sl - sp) & ~0b11);
+            int dp0 = dp;
+            while (sp < sl0) {
+                int b1 = base64[src[sp++] & 0xff];
+                int b2 = base64[src[sp++] & 0xff];
+                int b3 = base64[src[sp++] & 0xff];
+                int b4 = base64[src[sp++] & 0xff];
+                if ((b1 | b2 | b3 | b4) < 0) {    // non base64 byte
+                    break;
+                }
+                int bits0 = b1 << 18 | b2 << 12 | b3 << 6 | b4;
+                dst[dp0++] = (byte)(bits0 >> 16);
+                dst[dp0++] = (byte)(bits0 >>  8);
+                dst[dp0++] = (byte)(bits0);
+            }
+            return dp0 - dp;
+        }
+
         private int decode0(byte[] src, int sp, int sl, byte[] dst) {
             int[] base64 = isURL ? fromBase64URL : fromBase64;
             int dp = 0;
@@ -702,21 +734,10 @@ public class Base64 {
 
             while (sp < sl) {
                 if (shiftto == 18 && sp + 4 < sl) {       // fast path
-                    int sl0 = sp + ((sl - sp) & ~0b11);
-                    while (sp < sl0) {
-                        int b1 = base64[src[sp++] & 0xff];
-                        int b2 = base64[src[sp++] & 0xff];
-                        int b3 = base64[src[sp++] & 0xff];
-                        int b4 = base64[src[sp++] & 0xff];
-                        if ((b1 | b2 | b3 | b4) < 0) {    // non base64 byte
-                            sp -= 4;
-                            break;
-                        }
-                        int bits0 = b1 << 18 | b2 << 12 | b3 << 6 | b4;
-                        dst[dp++] = (byte)(bits0 >> 16);
-                        dst[dp++] = (byte)(bits0 >>  8);
-                        dst[dp++] = (byte)(bits0);
-                    }
+                    int dl = decodeBlock(src, sp, sl, dst, dp, isURL, isMIME);
+                    // every 3 bytes written consumed one 4-byte atom
+                    sp += dl / 3 * 4;
+                    dp += dl;
                     if (sp >= sl)
                         break;
                 }
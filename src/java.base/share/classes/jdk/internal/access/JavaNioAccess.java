@@ -39,4 +39,12 @@ public interface JavaNioAccess {
         long getMemoryUsed();
     }
     BufferPool getDirectBufferPool();
+
+    /**
+     * Constructs a direct ByteBuffer referring to the block of memory starting
+     * at the given memory address and extending {@code cap} bytes. The buffer
+     * has no cleaner; the memory is owned by the caller, and the given object
+     * is attached to the buffer to keep the owner reachable.
+     */
+    ByteBuffer newDirectByteBuffer(long addr, int cap, Object ob);
 }
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package jdk.internal.misc;
+
+import java.nio.ByteBuffer;
+
+import jdk.internal.access.JavaNioAccess;
+import jdk.internal.access.SharedSecrets;
+
+/**
+ * A scoped arena of native memory for short-lived buffers.
+ * <p>
+ * Memory is bump-allocated from chunks obtained with
+ * {@link Unsafe#allocateArenaChunk}, and all of it is freed at once by
+ * {@link #close}, typically at the end of a try-with-resources block.
+ * Allocations therefore need neither a {@code Cleaner} nor a reservation
+ * against the direct memory limit, and the memory is returned to the system
+ * when the scope ends rather than when a GC notices that the buffers died.
+ * The chunks are accounted to the "Native Arena" category of Native Memory
+ * Tracking.
+ * <p>
+ * An arena is not thread-safe. Addresses and buffers allocated from an arena
+ * must not be used after it is closed.
+ */
+public final class NativeArena implements AutoCloseable {
+
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final JavaNioAccess NIO_ACCESS = SharedSecrets.getJavaNioAccess();
+
+    /** The default size of the chunks of an arena, in bytes. */
+    public static final long DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    // Alignment of allocations unless requested otherwise, and of the chunks.
+    private static final long MIN_ALIGNMENT = 8;
+
+    private final long chunkSize;
+
+    // Chunks allocated so far.
+    private long[] chunks = new long[4];
+    private int chunkCount;
+
+    // Bump pointer and end of the current chunk.
+    private long top;
+    private long end;
+
+    private boolean closed;
+
+    private NativeArena(long chunkSize) {
+        this.chunkSize = chunkSize;
+    }
+
+    /**
+     * Opens a new arena with chunks of {@link #DEFAULT_CHUNK_SIZE} bytes.
+     */
+    public static NativeArena open() {
+        return new NativeArena(DEFAULT_CHUNK_SIZE);
+    }
+
+    /**
+     * Opens a new arena with chunks of the given size in bytes.
+     *
+     * @throws IllegalArgumentException if the chunk size is not positive
+     */
+    public static NativeArena open(long chunkSize) {
+        if (chunkSize <= 0 || chunkSize > Long.MAX_VALUE - (MIN_ALIGNMENT - 1)) {
+            throw new IllegalArgumentException("chunk size: " + chunkSize);
+        }
+        return new NativeArena((chunkSize + MIN_ALIGNMENT - 1) & -MIN_ALIGNMENT);
+    }
+
+    /**
+     * Allocates a block of the given size in bytes, aligned for all value
+     * types. The contents of the memory are uninitialized.
+     *
+     * @throws IllegalStateException if the arena is closed
+     * @throws IllegalArgumentException if the size is negative
+     * @throws OutOfMemoryError if the allocation is refused by the system
+     */
+    public long allocate(long bytes) {
+        return allocate(bytes, MIN_ALIGNMENT);
+    }
+
+    /**
+     * Allocates a block of the given size in bytes, aligned to the given
+     * power of two. The contents of the memory are uninitialized.
+     *
+     * @throws IllegalStateException if the arena is closed
+     * @throws IllegalArgumentException if the size is negative or the
+     *         alignment is not a power of two
+     * @throws OutOfMemoryError if the allocation is refused by the system
+     */
+    public long allocate(long bytes, long alignment) {
+        if (closed) {
+            throw new IllegalStateException("arena is closed");
+        }
+        if (bytes < 0) {
+            throw new IllegalArgumentException("size: " + bytes);
+        }
+        if (alignment <= 0 || (alignment & (alignment - 1)) != 0) {
+            throw new IllegalArgumentException("alignment: " + alignment);
+        }
+        if (top != 0) {
+            long p = (top + alignment - 1) & -alignment;
+            // Written to not overflow for huge sizes and alignments.
+            if (p >= top && bytes <= end - p) {
+                top = p + bytes;
+                return p;
+            }
+        }
+        return allocateSlow(bytes, Math.max(alignment, MIN_ALIGNMENT));
+    }
+
+    private long allocateSlow(long bytes, long alignment) {
+        // Chunks are aligned to MIN_ALIGNMENT; over-allocate for larger
+        // alignments.
+        long padding = alignment - MIN_ALIGNMENT;
+        if (bytes > Long.MAX_VALUE - padding) {
+            throw new OutOfMemoryError("Unable to allocate " + bytes + " bytes");
+        }
+        if (bytes + padding > chunkSize / 4) {
+            // Give large blocks a chunk of their own, so that the rest of
+            // the current chunk is not wasted.
+            long chunk = newChunk(bytes + padding);
+            return (chunk + alignment - 1) & -alignment;
+        }
+        long chunk = newChunk(chunkSize);
+        long p = (chunk + alignment - 1) & -alignment;
+        top = p + bytes;
+        end = chunk + chunkSize;
+        return p;
+    }
+
+    private long newChunk(long bytes) {
+        if (chunkCount == chunks.length) {
+            long[] a = new long[chunkCount * 2];
+            System.arraycopy(chunks, 0, a, 0, chunkCount);
+            chunks = a;
+        }
+        long chunk = UNSAFE.allocateArenaChunk(Math.max(bytes, 1));
+        chunks[chunkCount++] = chunk;
+        return chunk;
+    }
+
+    /**
+     * Allocates a direct byte buffer of the given capacity from this arena.
+     * The buffer has no cleaner; its memory is freed when the arena is
+     * closed, and the buffer must not be used afterwards.
+     *
+     * @throws IllegalStateException if the arena is closed
+     * @throws IllegalArgumentException if the capacity is negative
+     * @throws OutOfMemoryError if the allocation is refused by the system
+     */
+    public ByteBuffer allocateDirect(int capacity) {
+        if (capacity < 0) {
+            throw new IllegalArgumentException("capacity: " + capacity);
+        }
+        long addr = allocate(capacity);
+        return NIO_ACCESS.newDirectByteBuffer(addr, capacity, this);
+    }
+
+    /**
+     * Frees all memory allocated from this arena. Closing a closed arena
+     * has no effect.
+     */
+    @Override
+    public void close() {
+        if (closed) {
+            return;
+        }
+        closed = true;
+        for (int i = 0; i < chunkCount; i++) {
+            UNSAFE.freeArenaChunk(chunks[i]);
+        }
+        chunks = null;
+        chunkCount = 0;
+        top = 0;
+        end = 0;
+    }
+}
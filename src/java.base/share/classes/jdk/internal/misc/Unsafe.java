@@ -920,6 +920,53 @@ public final class Unsafe {
         checkPointer(null, address);
     }
 
+    /**
+     * Allocates a chunk of native memory for a {@link NativeArena}, of the
+     * given size in bytes.  Behaves like {@link #allocateMemory}, except that
+     * the memory is accounted to the arenas by Native Memory Tracking.
+     * Dispose of this memory by calling {@link #freeArenaChunk}.
+     *
+     * @throws RuntimeException if the size is negative or too large
+     *         for the native size_t type
+     *
+     * @throws OutOfMemoryError if the allocation is refused by the system
+     *
+     * @see #allocateMemory
+     */
+    public long allocateArenaChunk(long bytes) {
+        allocateMemoryChecks(bytes);
+
+        if (bytes == 0) {
+            return 0;
+        }
+
+        long p = allocateArenaChunk0(bytes);
+        if (p == 0) {
+            throw new OutOfMemoryError();
+        }
+
+        return p;
+    }
+
+    /**
+     * Disposes of a chunk of native memory, as obtained from {@link
+     * #allocateArenaChunk}.  The address passed to this method may be null,
+     * in which case no action is taken.
+     *
+     * @throws RuntimeException if any of the arguments is invalid
+     *
+     * @see #allocateArenaChunk
+     */
+    public void freeArenaChunk(long address) {
+        freeMemoryChecks(address);
+
+        if (address == 0) {
+            return;
+        }
+
+        freeArenaChunk0(address);
+    }
+
     /// random queries
 
     /**
@@ -3701,6 +3748,8 @@ public final class Unsafe {
     private native long allocateMemory0(long bytes);
     private native long reallocateMemory0(long address, long bytes);
     private native void freeMemory0(long address);
+    private native long allocateArenaChunk0(long bytes);
+    private native void freeArenaChunk0(long address);
     private native void setMemory0(Object o, long offset, long bytes, byte value);
     @HotSpotIntrinsicCandidate
     private native void copyMemory0(Object srcBase, long srcOffset, Object destBase, long destOffset, long bytes);
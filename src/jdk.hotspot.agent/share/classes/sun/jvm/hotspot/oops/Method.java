@@ -263,7 +263,7 @@ public class Method extends Metadata {
   }
 
   public long getSize() {
-    return type.getSize() + (isNative() ? 2: 0);
+    return type.getSize() + (isNative() ? 3: 0);
   }
 
   public void printValueOn(PrintStream tty) {
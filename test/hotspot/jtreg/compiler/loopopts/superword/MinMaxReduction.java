@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+/**
+ * @test
+ * @summary Int min/max/abs loops and min/max reductions must be vectorized
+ *          correctly for every vector size, including 2 lane vectors that
+ *          have no reduction rules.
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      compiler.loopopts.superword.MinMaxReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+IgnoreUnrecognizedVMOptions -XX:MaxVectorSize=8
+ *      compiler.loopopts.superword.MinMaxReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+IgnoreUnrecognizedVMOptions -XX:MaxVectorSize=16
+ *      compiler.loopopts.superword.MinMaxReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+IgnoreUnrecognizedVMOptions -XX:MaxVectorSize=32
+ *      compiler.loopopts.superword.MinMaxReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-SuperWordReductions
+ *      compiler.loopopts.superword.MinMaxReduction
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Random;
+
+public class MinMaxReduction {
+    private static final int LENGTH = 1021;   // not a multiple of the unroll factor
+    private static final int ITERATIONS = 20_000;
+
+    private static final int[] a = new int[LENGTH];
+    private static final int[] b = new int[LENGTH];
+    private static final int[] r = new int[LENGTH];
+
+    static int minReduction(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = Math.min(min, a[i]);
+        }
+        return min;
+    }
+
+    static int maxReduction(int[] a) {
+        int max = Integer.MIN_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            max = Math.max(max, a[i]);
+        }
+        return max;
+    }
+
+    static int minReductionIdiom(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = a[i] < min ? a[i] : min;
+        }
+        return min;
+    }
+
+    static void minVector(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = Math.min(a[i], b[i]);
+        }
+    }
+
+    static void maxVector(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = Math.max(a[i], b[i]);
+        }
+    }
+
+    static void absVector(int[] a, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[i] < 0 ? -a[i] : a[i];
+        }
+    }
+
+    static long checksum(int[] r) {
+        long sum = 0;
+        for (int i = 0; i < r.length; i++) {
+            sum = 31 * sum + r[i];
+        }
+        return sum;
+    }
+
+    static long[] run() {
+        long[] results = new long[6];
+        results[0] = minReduction(a);
+        results[1] = maxReduction(a);
+        results[2] = minReductionIdiom(a);
+        minVector(a, b, r);
+        results[3] = checksum(r);
+        maxVector(a, b, r);
+        results[4] = checksum(r);
+        absVector(a, r);
+        results[5] = checksum(r);
+        return results;
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        for (int i = 0; i < LENGTH; i++) {
+            a[i] = random.nextInt();
+            b[i] = random.nextInt();
+        }
+        a[LENGTH / 2] = Integer.MIN_VALUE;   // abs overflows, must stay MIN_VALUE
+        b[LENGTH - 1] = Integer.MAX_VALUE;
+
+        // The first run is interpreted and gives the expected results.
+        long[] expected = run();
+        for (int i = 0; i < ITERATIONS; i++) {
+            long[] actual = run();
+            for (int j = 0; j < expected.length; j++) {
+                if (actual[j] != expected[j]) {
+                    throw new RuntimeException("Result " + j + " in iteration " + i +
+                                               ": expected " + expected[j] + ", got " + actual[j]);
+                }
+            }
+        }
+    }
+}